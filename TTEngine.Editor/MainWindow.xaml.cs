@@ -188,6 +188,7 @@ namespace TTEngine.Editor
             {
                 _undoStack.Push(_currentBatch);
                 _redoStack.Clear();
+                SendLiveTiles(_currentBatch, false);
             }
 
             _currentBatch = null;
@@ -575,6 +576,7 @@ namespace TTEngine.Editor
             {
                 _undoStack.Push(_currentBatch);
                 _redoStack.Clear();
+                SendLiveTiles(_currentBatch, false);
             }
 
             _currentBatch = null;
@@ -736,7 +738,9 @@ namespace TTEngine.Editor
                 };
             }
 
+            Point from = ActiveMap.PlayerSpawn.Position;
             ActiveMap.PlayerSpawn.Position = new Point(x, y);
+            LiveLinkService.SendSpawnMove(editorState.ActiveMapId, LiveLinkService.SpawnKind.Player, from, ActiveMap.PlayerSpawn.Position);
             DrawGrid();
             return true;
         }
@@ -887,6 +891,7 @@ namespace TTEngine.Editor
             var batch = _undoStack.Pop();
             batch.Undo(ActiveTiles);
             _redoStack.Push(batch);
+            SendLiveTiles(batch, true);
 
             DrawGrid();
         }
@@ -899,10 +904,20 @@ namespace TTEngine.Editor
             var batch = _redoStack.Pop();
             batch.Redo(ActiveTiles);
             _undoStack.Push(batch);
+            SendLiveTiles(batch, false);
 
             DrawGrid();
         }
 
+        //A running engine only plays the collision layer, the rest waits for the next save
+        private void SendLiveTiles(TileBatchCommand batch, bool undo)
+        {
+            if (editorState.IsDefaultMap || editorState.ActiveLayer.LayerType != MapLayerType.Collision)
+                return;
+
+            LiveLinkService.SendTiles(editorState.ActiveMapId, batch.Commands.Select(c => (c.Index, undo ? c.OldValue : c.NewValue)));
+        }
+
         #endregion
 
         #region Load Map
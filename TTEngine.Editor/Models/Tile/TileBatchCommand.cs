@@ -11,6 +11,8 @@
 
         public bool IsEmpty() => _commands.Count == 0;
 
+        public IReadOnlyList<TileChangeCommand> Commands => _commands;
+
         public void Undo(int[] tiles)
         {
             for (int i = _commands.Count - 1; i >= 0; i--)
@@ -76,6 +76,7 @@ namespace TTEngine.Editor.Panels
             _current.DeathAnimation = (DeathAnimCombo.SelectedItem as AnimationDefinition)?.Id;
 
             EntityDefinitionService.Save(_definitions);
+            LiveLinkService.SendDefinition(LiveLinkService.DefinitionKind.Entity, _current);
         }
 
         private void NewDefClicked(object sender, RoutedEventArgs e)
@@ -141,6 +141,7 @@ namespace TTEngine.Editor.Panels
             }
 
             InteractableFileService.Save(Interactables.ToList());
+            LiveLinkService.SendDefinition(LiveLinkService.DefinitionKind.Interactable, SelectedInteractable);
         }
     }
 }
@@ -158,6 +158,7 @@ namespace TTEngine.Editor.Panels
             }
 
             TrapFileService.Save(Traps.ToList());
+            LiveLinkService.SendDefinition(LiveLinkService.DefinitionKind.Trap, SelectedTrap);
         }
     }
 }
@@ -1,4 +1,5 @@
-﻿using System.IO;
+﻿using System.Diagnostics;
+using System.IO;
 using System.IO.Compression;
 
 namespace TTEngine.Editor.Services
@@ -26,13 +27,11 @@ namespace TTEngine.Editor.Services
 
             //Build Folder Struture
             string buildRoot = Path.Combine(targetFolder, buildName);
-            string buildAssets = Path.Combine(buildRoot, "Assets");
 
             if(Directory.Exists(buildRoot))
                 Directory.Delete(buildRoot, true);
 
             Directory.CreateDirectory(buildRoot);
-            Directory.CreateDirectory(buildAssets);
 
             //Copy Exe
             File.Copy(engineExe, Path.Combine(buildRoot, $"{buildName}.exe"));
@@ -40,8 +39,9 @@ namespace TTEngine.Editor.Services
             //Copy DLLs
             CopyRuntimeDLLs(engineDir, buildRoot);
 
-            //Copy Assets
-            CopyDirectory(assetsDir, buildAssets);
+            //Cook what changed since the last build + Pack Assets
+            RunCooker("cook", assetsDir);
+            RunCooker("pak", assetsDir, Path.Combine(buildRoot, "Assets.ttpak"));
 
             //MetaData
             string version = "1.0.0";
@@ -65,15 +65,27 @@ namespace TTEngine.Editor.Services
             }
         }
 
-        private static void CopyDirectory(string source, string target)
+        private static void RunCooker(params string[] args)
         {
-            Directory.CreateDirectory(target);
+            string cooker = EditorPaths.GetCookerExe();
+            if (!File.Exists(cooker))
+                throw new FileNotFoundException("Cooker exe not found", cooker);
 
-            foreach (var f in Directory.GetFiles(source))
-                File.Copy(f, Path.Combine(target, Path.GetFileName(f)));
-
-            foreach (var dir in Directory.GetDirectories(source))
-                CopyDirectory(dir, Path.Combine(target, Path.GetFileName(dir)));
+            var info = new ProcessStartInfo(cooker)
+            {
+                UseShellExecute = false,
+                CreateNoWindow = true,
+                RedirectStandardError = true
+            };
+            foreach (var arg in args)
+                info.ArgumentList.Add(arg);
+
+            using var process = Process.Start(info)!;
+            string errors = process.StandardError.ReadToEnd();
+            process.WaitForExit();
+
+            if (process.ExitCode != 0)
+                throw new InvalidOperationException($"Cooker '{args[0]}' failed: {errors}");
         }
 
         private static void WriteReadme(string target, string version)
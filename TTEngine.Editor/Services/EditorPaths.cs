@@ -5,6 +5,7 @@ namespace TTEngine.Editor.Services
     public static class EditorPaths
     {
         private const string ENGINE_NAME = "TTEngine.exe";
+        private const string COOKER_NAME = "TTCook.exe";
 
         public static string GetProjectRoot()
         {
@@ -57,6 +58,11 @@ namespace TTEngine.Editor.Services
 #endif
         }
 
+        public static string GetCookerExe()
+        {
+            return Path.Combine(Path.GetDirectoryName(GetEngineExe())!, COOKER_NAME);
+        }
+
         private static string GetEngineExeBase()
         {
             var root = GetProjectRoot();
@@ -0,0 +1,118 @@
+﻿using System.IO;
+using System.Net;
+using System.Net.Sockets;
+using System.Text;
+using System.Text.Json;
+using System.Windows;
+
+namespace TTEngine.Editor.Services
+{
+    //Sends edits to a running engine started from loose assets, nothing happens when none is listening
+    public static class LiveLinkService
+    {
+        private const int PORT = 47017;
+        private const uint MAGIC = 0x4C4C5454; //"TTLL"
+        private const ushort VERSION = 1;
+        private const int CONNECT_TIMEOUT_MS = 200;
+
+        private enum Message : ushort
+        {
+            Tiles = 1,
+            MoveSpawn = 2,
+            Definition = 3
+        }
+
+        public enum SpawnKind : uint
+        {
+            Player = 0,
+            Interactable = 1,
+            Trap = 2
+        }
+
+        public enum DefinitionKind : uint
+        {
+            Entity = 0,
+            Interactable = 1,
+            Trap = 2
+        }
+
+        //Collision layer cells as index and value
+        public static void SendTiles(string mapId, IEnumerable<(int Index, int Value)> tiles)
+        {
+            var list = tiles.ToList();
+            if (list.Count == 0)
+                return;
+
+            Send(Message.Tiles, writer =>
+            {
+                WriteString(writer, mapId);
+                writer.Write((uint)list.Count);
+                foreach (var (index, value) in list)
+                {
+                    writer.Write((uint)index);
+                    writer.Write((uint)value);
+                }
+            });
+        }
+
+        //Positions in tiles, from is where the spawn was placed before the move
+        public static void SendSpawnMove(string mapId, SpawnKind kind, Point from, Point to)
+        {
+            Send(Message.MoveSpawn, writer =>
+            {
+                WriteString(writer, mapId);
+                writer.Write((uint)kind);
+                writer.Write((float)from.X);
+                writer.Write((float)from.Y);
+                writer.Write((float)to.X);
+                writer.Write((float)to.Y);
+            });
+        }
+
+        //Serialized like the definition files so the engine reads the same keys
+        public static void SendDefinition<T>(DefinitionKind kind, T record)
+        {
+            if (record == null)
+                return;
+
+            string json = JsonSerializer.Serialize(record);
+            Send(Message.Definition, writer =>
+            {
+                writer.Write((uint)kind);
+                writer.Write(Encoding.UTF8.GetBytes(json));
+            });
+        }
+
+        private static void WriteString(BinaryWriter writer, string text)
+        {
+            byte[] bytes = Encoding.UTF8.GetBytes(text ?? string.Empty);
+            writer.Write((uint)bytes.Length);
+            writer.Write(bytes);
+        }
+
+        private static void Send(Message type, Action<BinaryWriter> writePayload)
+        {
+            using var payload = new MemoryStream();
+            using (var writer = new BinaryWriter(payload, Encoding.UTF8, true))
+                writePayload(writer);
+
+            try
+            {
+                using var client = new TcpClient();
+                if (!client.ConnectAsync(IPAddress.Loopback, PORT).Wait(CONNECT_TIMEOUT_MS))
+                    return;
+
+                using var stream = client.GetStream();
+                using var writer = new BinaryWriter(stream);
+                writer.Write(MAGIC);
+                writer.Write((ushort)type);
+                writer.Write(VERSION);
+                writer.Write((uint)payload.Length);
+                writer.Write(payload.GetBuffer(), 0, (int)payload.Length);
+            }
+            catch (AggregateException) { }
+            catch (SocketException) { }
+            catch (IOException) { }
+        }
+    }
+}
@@ -1,4 +1,5 @@
 #include "Core/Animation.h"
+#include <algorithm>
 
 namespace EngineCore
 {
@@ -48,6 +49,22 @@ namespace EngineCore
 		m_PreviousFrame = -1;
 	}
 
+	void Animation::CopyPlayback(const Animation& other)
+	{
+		int last = std::max(0, (int)m_Frames.size() - 1);
+		m_Timer = std::min(other.m_Timer, m_FrameTime);
+		m_CurrentFrame = std::min(other.m_CurrentFrame, last);
+		m_PreviousFrame = std::min(other.m_PreviousFrame, last);
+	}
+
+	void Animation::SetPlayback(const AnimationPlayback& playback)
+	{
+		int last = std::max(0, (int)m_Frames.size() - 1);
+		m_Timer = std::min(playback.timer, m_FrameTime);
+		m_CurrentFrame = std::clamp(playback.currentFrame, 0, last);
+		m_PreviousFrame = std::min(playback.previousFrame, last);
+	}
+
 	bool Animation::IsFinished() const
 	{
 		return	!m_Loop && 
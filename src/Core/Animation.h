@@ -1,13 +1,30 @@
 #pragma once
 #include <vector>
+#include <memory_resource>
+#include <span>
 #include <SDL3/SDL.h>
 #include "Game/Texture.h"
+#include "Core/StringId.h"
 
 namespace EngineCore
 {
+	//Playback position only, the frames stay with the animation
+	struct AnimationPlayback
+	{
+		float timer;
+		int currentFrame;
+		int previousFrame;
+	};
+
 	class Animation
 	{
 	public:
+		using allocator_type = std::pmr::polymorphic_allocator<>;
+
+		Animation() = default;
+		explicit Animation(const allocator_type& allocator) : m_Frames(allocator), m_EventFrames(allocator) {}
+		allocator_type GetAllocator() const { return m_Frames.get_allocator(); }
+
 		void Update(float dt);
 		const SDL_FRect& GetCurrentFrame() const;
 
@@ -21,20 +38,29 @@ namespace EngineCore
 		void Reset();
 		bool IsFinished() const;
 
-		void SetEventFrames(const std::vector<int>& frames) { m_EventFrames = frames; }
+		void SetEventFrames(std::span<const int> frames) { m_EventFrames.assign(frames.begin(), frames.end()); }
 		bool IsEventTriggered() const;
 		bool IsInEventWindow() const;
 
-		void SetTexture(EngineGame::Texture2D* tex) { m_Texture = tex; }
-		EngineGame::Texture2D* GetTexture() const { return m_Texture; }
+		void SetTexture(EngineGame::TextureHandle tex) { m_Texture = tex; }
+		EngineGame::TextureHandle GetTexture() const { return m_Texture; }
+
+		//Definition the frames were built from, used by hot reload
+		void SetSource(StringId source) { m_Source = source; }
+		StringId GetSource() const { return m_Source; }
+		void CopyPlayback(const Animation& other);	//Keeps the frame and timer of a rebuilt animation
+
+		AnimationPlayback GetPlayback() const { return { m_Timer, m_CurrentFrame, m_PreviousFrame }; }
+		void SetPlayback(const AnimationPlayback& playback);
 	private:
-		std::vector<SDL_FRect> m_Frames;
+		std::pmr::vector<SDL_FRect> m_Frames;
 		float m_Timer = 0.0f;
 		float m_FrameTime = 0.15f;
 		int m_CurrentFrame = 0;
 		int m_PreviousFrame = -1;
 		bool m_Loop = true;
-		EngineGame::Texture2D* m_Texture = nullptr;
-		std::vector<int> m_EventFrames;
+		EngineGame::TextureHandle m_Texture = EngineGame::INVALID_TEXTURE;
+		std::pmr::vector<int> m_EventFrames;
+		StringId m_Source;
 	};
 }
\ No newline at end of file
@@ -8,30 +8,78 @@
 #include "Platform/AssetManager.h"
 #include "Platform/RendererSdl.h"
 #include "Platform/LevelManager.h"
+#include "Platform/HotReload.h"
+#include "Platform/LiveLink.h"
 #include "Core/PathUtil.h"
+#include "Core/JobSystem.h"
+#include "Core/AsyncIO.h"
+#include "Core/FileSystem.h"
+#include "Core/StartupGraph.h"
+#include <filesystem>
 
 namespace EngineCore
 {
-	Application::Application()
+	Application::Application(const EnginePlatform::NetplaySettings& netplay)
+		: m_Context(netplay.enabled ? m_NetplayInput : Input::GetState()), m_Scene(m_Context)
 	{
+		m_StartCounter = SDL_GetPerformanceCounter();
 		Log::Init();
-		EnginePlatform::Window::Init("TTEngine", 800, 600);
-		EnginePlatform::RendererSdl::Init();
+		FileSystem::Init();
+		JobSystem::Init();
+		AsyncIO::Init();
+
+		//Video and the renderer stay on the main thread, file reads and parsing overlap them on the workers
+		StartupGraph startup;
+		startup.Add("Window", StageThread::Main, []() { EnginePlatform::Window::Init("TTEngine", 800, 600); });
+		startup.Add("Renderer", StageThread::Main, []() { EnginePlatform::RendererSdl::Init(); }, { "Window" });
+		startup.Add("Fonts", StageThread::Worker, []() { EnginePlatform::RendererSdl::InitText(); });
+		startup.Add("Assets", StageThread::Main, [this]()
+		{
+			m_Renderer = EnginePlatform::RendererSdl::Get();
+			DebugOverlay::Init(m_Renderer);
+			EnginePlatform::AssetManager::Init(EnginePlatform::RendererSdl::GetSdl());
+		}, { "Renderer", "Fonts" });
 
-		m_Renderer = EnginePlatform::RendererSdl::Get();
-		DebugOverlay::Init(m_Renderer);
-		EnginePlatform::AssetManager::Init(EnginePlatform::RendererSdl::GetSdl());
-	
-		EnginePlatform::LevelManager::Get().LoadAllLevels(EngineCore::GetFile("Data", "Levels.json"));
-		EnginePlatform::LevelManager::Get().StartLevelByIndex(0);
+		startup.Add("Levels", StageThread::Worker, [this]()
+		{
+			EnginePlatform::LevelManager::LoadAllLevels(EngineCore::GetFile("Data", "Levels.json"));
+			m_Context.GetLevels().StartLevelByIndex(0);
+		});
+		startup.Add("Definitions", StageThread::Worker, [this]() { m_Scene.LoadDefinitions(); });
+		//First map is read now, its textures decode behind the main menu
+		startup.Add("LevelPrefetch", StageThread::Worker, [this]() { m_Scene.PrefetchCurrentLevel(); }, { "Levels" });
+
+		startup.Add("Scene", StageThread::Main, [this]()
+		{
+			m_Scene.Load();
+			EnginePlatform::HotReload::Init();
+			EnginePlatform::LiveLink::Init();
+		}, { "Assets", "Definitions", "LevelPrefetch" });
+
+		m_Running = startup.Run();
 
-		m_Scene.Load();
+		//Both peers skip the menu and start the first level together
+		if (m_Running && netplay.enabled)
+		{
+			m_Netplay = std::make_unique<EnginePlatform::RollbackSession>(m_Scene, m_NetplayInput);
+			m_Running = m_Netplay->Start(netplay);
+		}
 	}
 
 	Application::~Application()
 	{
-		EnginePlatform::Window::Shutdown();
+		if (m_Netplay)
+			m_Netplay->Stop();
+
+		EnginePlatform::LiveLink::Shutdown();
+		EnginePlatform::HotReload::Shutdown();
+
+		//Workers first so no decode lands after the textures are gone
+		JobSystem::Shutdown();
+		EnginePlatform::AssetManager::Shutdown();
 		EnginePlatform::RendererSdl::Shutdown();
+		EnginePlatform::Window::Shutdown();
+		FileSystem::Shutdown();
 	}
 
 	void Application::Run()
@@ -42,11 +90,32 @@ namespace EngineCore
 			DebugOverlay::BeginFrame();
 			Time::Update();
 
+			//Edited assets land between frames, before anything reads them
+			EnginePlatform::ReloadSet reloaded;
+			if (EnginePlatform::HotReload::Poll(reloaded))
+				m_Scene.ApplyReload(reloaded);
+
+			EnginePlatform::LiveEdits edits;
+			if (EnginePlatform::LiveLink::Poll(edits))
+				m_Scene.ApplyLiveEdits(edits);
+
 			Input::BeginFrame();
 			ProcessInput();
 			Update(Time::GetDeltaTime());
+			EnginePlatform::AssetManager::Update();
 			Render();
 
+			if (!m_FirstFrame)
+			{
+				m_FirstFrame = true;
+				double elapsedMs = (SDL_GetPerformanceCounter() - m_StartCounter) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+				Log::Write(
+					LogLevel::Info,
+					LogCategory::Core,
+					"First frame presented " + std::to_string(elapsedMs) + " ms after start"
+				);
+			}
+
 			Debug::EndFrame();
 		}
 	}
@@ -89,10 +158,49 @@ namespace EngineCore
 		{
 			DebugOverlay::AddLine("FPS: " + std::to_string(Debug::GetFPS()));
 			DebugOverlay::AddLine("Player hp: " + std::to_string(m_Scene.GetPlayer().GetHp()));
+			AddTextureLines();
+			if (m_Netplay)
+				AddNetplayLines();
 		}
 
 		//Input::Update();
-		m_Scene.Update(deltaTime);
+		if (m_Netplay)
+			m_Netplay->Update(deltaTime, Input::GetState());
+		else
+			m_Scene.Update(deltaTime);
+	}
+
+	void Application::AddTextureLines()
+	{
+		auto toKb = [](size_t bytes) { return std::to_string(bytes / 1024) + " KB"; };
+
+		DebugOverlay::AddLine(
+			"Textures: " + toKb(EnginePlatform::AssetManager::GetResidentBytes()) +
+			" / " + toKb(EnginePlatform::AssetManager::GetMemoryBudget())
+		);
+
+		for (const auto& stats : EnginePlatform::AssetManager::GetResidentStats())
+		{
+			std::string name = std::filesystem::path(stats.path).filename().string();
+			DebugOverlay::AddLine("  " + name + " " + toKb(stats.bytes) + " x" + std::to_string(stats.refCount));
+		}
+	}
+
+	void Application::AddNetplayLines()
+	{
+		const EnginePlatform::NetplayStats& stats = m_Netplay->GetStats();
+
+		DebugOverlay::AddLine(
+			"Netplay: frame " + std::to_string(stats.frame) + " confirmed " + std::to_string(stats.confirmedFrame) +
+			(stats.connected ? "" : " (waiting for peer)")
+		);
+		DebugOverlay::AddLine(
+			"  Rollback " + std::to_string(stats.lastRollback) + " frames " + std::to_string(stats.lastRollbackMs) +
+			" ms, max " + std::to_string(stats.maxRollbackMs) + " ms"
+		);
+
+		if (stats.desyncFrame >= 0)
+			DebugOverlay::AddLine("  Desync at frame " + std::to_string(stats.desyncFrame));
 	}
 
 	void Application::Render()
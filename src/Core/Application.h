@@ -1,5 +1,8 @@
 #pragma once
 #include "Platform/Scene.h"
+#include "Platform/RollbackSession.h"
+#include <cstdint>
+#include <memory>
 
 namespace EngineCore 
 {
@@ -7,17 +10,24 @@ namespace EngineCore
 	class Application
 	{
 	public:
-		Application();
+		explicit Application(const EnginePlatform::NetplaySettings& netplay = {});
 		~Application();
 
 		void Run();
 	private:
 		bool m_Running = true;
+		bool m_FirstFrame = false;		//Time to first frame is logged once
+		uint64_t m_StartCounter = 0;
 		IRenderer* m_Renderer = nullptr;
+		InputState m_NetplayInput;					//Both players' keys, written by the rollback session
+		EnginePlatform::EngineContext m_Context;	//The windowed game, reads the window's input unless in netplay
 		EnginePlatform::Scene m_Scene;  
+		std::unique_ptr<EnginePlatform::RollbackSession> m_Netplay;
 
 		void ProcessInput();
 		void Update(float deltaTime);
+		void AddTextureLines();
+		void AddNetplayLines();
 		void Render();
 	};
 }
\ No newline at end of file
@@ -0,0 +1,452 @@
+#include "Core/AsyncIO.h"
+#include "Core/FileSystem.h"
+#include "Core/JobSystem.h"
+#include "Core/Log.h"
+#include <vector>
+#include <deque>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <algorithm>
+#include <cstring>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define TT_IO_URING 1
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+namespace EngineCore
+{
+	bool AsyncIO::s_Uring = false;
+
+#ifdef TT_IO_URING
+	constexpr unsigned URING_DEPTH = 64;
+	constexpr size_t URING_MAX_READ = 1u << 30;
+
+	//Minimal submission/completion ring over the raw syscalls, one per pump
+	class UringQueue
+	{
+	public:
+		~UringQueue()
+		{
+			if (m_Sqes) munmap(m_Sqes, m_SqesSize);
+			if (m_CqRing && m_CqRing != m_SqRing) munmap(m_CqRing, m_CqRingSize);
+			if (m_SqRing) munmap(m_SqRing, m_SqRingSize);
+			if (m_Fd >= 0) close(m_Fd);
+		}
+
+		bool Init(unsigned entries)
+		{
+			io_uring_params params{};
+			m_Fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+			if (m_Fd < 0)
+				return false;
+
+			m_SqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+			m_CqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+			bool singleMap = params.features & IORING_FEAT_SINGLE_MMAP;
+			if (singleMap)
+				m_SqRingSize = m_CqRingSize = std::max(m_SqRingSize, m_CqRingSize);
+
+			m_SqRing = Map(m_SqRingSize, IORING_OFF_SQ_RING);
+			m_CqRing = singleMap ? m_SqRing : Map(m_CqRingSize, IORING_OFF_CQ_RING);
+			m_SqesSize = params.sq_entries * sizeof(io_uring_sqe);
+			m_Sqes = static_cast<io_uring_sqe*>(Map(m_SqesSize, IORING_OFF_SQES));
+			if (!m_SqRing || !m_CqRing || !m_Sqes)
+				return false;
+
+			uint8_t* sq = static_cast<uint8_t*>(m_SqRing);
+			m_SqHead = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+			m_SqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+			m_SqMask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+			m_SqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+			m_SqEntries = params.sq_entries;
+
+			uint8_t* cq = static_cast<uint8_t*>(m_CqRing);
+			m_CqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+			m_CqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+			m_CqMask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+			m_Cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+			return true;
+		}
+
+		bool PushRead(int fd, uint8_t* buffer, size_t size, uint64_t offset, uint64_t userData)
+		{
+			unsigned tail = *m_SqTail;
+			if (tail - __atomic_load_n(m_SqHead, __ATOMIC_ACQUIRE) >= m_SqEntries)
+				return false;
+
+			unsigned index = tail & m_SqMask;
+			io_uring_sqe& sqe = m_Sqes[index];
+			std::memset(&sqe, 0, sizeof(sqe));
+			sqe.opcode = IORING_OP_READ;
+			sqe.fd = fd;
+			sqe.addr = reinterpret_cast<uint64_t>(buffer);
+			sqe.len = static_cast<uint32_t>(std::min(size, URING_MAX_READ));
+			sqe.off = offset;
+			sqe.user_data = userData;
+
+			m_SqArray[index] = index;
+			__atomic_store_n(m_SqTail, tail + 1, __ATOMIC_RELEASE);
+			m_Unsubmitted++;
+			return true;
+		}
+
+		//Submits queued reads and blocks until at least one completion is ready
+		bool SubmitAndWait()
+		{
+			while (true)
+			{
+				long submitted = syscall(__NR_io_uring_enter, m_Fd, m_Unsubmitted, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+				if (submitted >= 0)
+				{
+					m_Unsubmitted -= static_cast<unsigned>(submitted);
+					return true;
+				}
+
+				if (errno != EINTR)
+					return false;
+			}
+		}
+
+		bool PopCompletion(io_uring_cqe& outCqe)
+		{
+			unsigned head = *m_CqHead;
+			if (head == __atomic_load_n(m_CqTail, __ATOMIC_ACQUIRE))
+				return false;
+
+			outCqe = m_Cqes[head & m_CqMask];
+			__atomic_store_n(m_CqHead, head + 1, __ATOMIC_RELEASE);
+			return true;
+		}
+	private:
+		void* Map(size_t size, uint64_t offset)
+		{
+			void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_Fd, static_cast<off_t>(offset));
+			return ptr == MAP_FAILED ? nullptr : ptr;
+		}
+
+		int m_Fd = -1;
+		void* m_SqRing = nullptr;
+		void* m_CqRing = nullptr;
+		io_uring_sqe* m_Sqes = nullptr;
+		size_t m_SqRingSize = 0;
+		size_t m_CqRingSize = 0;
+		size_t m_SqesSize = 0;
+
+		unsigned* m_SqHead = nullptr;
+		unsigned* m_SqTail = nullptr;
+		unsigned* m_SqArray = nullptr;
+		unsigned m_SqMask = 0;
+		unsigned m_SqEntries = 0;
+		unsigned m_Unsubmitted = 0;
+
+		unsigned* m_CqHead = nullptr;
+		unsigned* m_CqTail = nullptr;
+		unsigned m_CqMask = 0;
+		io_uring_cqe* m_Cqes = nullptr;
+	};
+#endif
+
+	struct ReadBatchState
+	{
+		struct Entry
+		{
+			std::string path;
+			ReadCallback onComplete;
+		};
+
+		struct Completion
+		{
+			size_t index;
+			FileData file;
+			bool ok;
+		};
+
+		std::vector<Entry> entries;
+		bool submitted = false;
+		bool useUring = false;
+
+		std::atomic<size_t> nextRead = 0;	//Job system backend
+		std::atomic<bool> pumpClaimed = false;	//io_uring backend
+
+		std::mutex mutex;
+		std::condition_variable changed;
+		std::deque<Completion> completions;
+		size_t remaining = 0;
+	};
+
+	//Runs one finished read's callback, false when none is waiting
+	static bool RunCompletion(const std::shared_ptr<ReadBatchState>& state)
+	{
+		ReadBatchState::Completion completion;
+		{
+			std::lock_guard<std::mutex> lock(state->mutex);
+			if (state->completions.empty())
+				return false;
+
+			completion = std::move(state->completions.front());
+			state->completions.pop_front();
+		}
+
+		state->entries[completion.index].onComplete(completion.file, completion.ok);
+
+		std::lock_guard<std::mutex> lock(state->mutex);
+		if (--state->remaining == 0)
+			state->changed.notify_all();
+		return true;
+	}
+
+	static void Complete(const std::shared_ptr<ReadBatchState>& state, size_t index, FileData file, bool ok)
+	{
+		{
+			std::lock_guard<std::mutex> lock(state->mutex);
+			state->completions.push_back({ index, std::move(file), ok });
+		}
+		state->changed.notify_all();
+
+		//Parsing starts while the remaining reads are still in flight
+		if (JobSystem::GetWorkerCount() > 0)
+			JobSystem::Submit([state]() { RunCompletion(state); });
+	}
+
+	static void ReadBlocking(const std::shared_ptr<ReadBatchState>& state, size_t index)
+	{
+		FileData file;
+		bool ok = FileSystem::Read(state->entries[index].path, file);
+		Complete(state, index, std::move(file), ok);
+	}
+
+	static bool ReadNext(const std::shared_ptr<ReadBatchState>& state)
+	{
+		size_t index = state->nextRead.fetch_add(1);
+		if (index >= state->entries.size())
+			return false;
+
+		ReadBlocking(state, index);
+		return true;
+	}
+
+#ifdef TT_IO_URING
+	static bool PumpUring(const std::shared_ptr<ReadBatchState>& state)
+	{
+		UringQueue ring;
+		if (!ring.Init(URING_DEPTH))
+			return false;
+
+		struct PendingRead
+		{
+			int fd = -1;
+			std::vector<uint8_t> buffer;
+			size_t done = 0;
+		};
+
+		size_t count = state->entries.size();
+		std::vector<PendingRead> reads(count);
+		size_t next = 0;
+		unsigned inFlight = 0;
+
+		//Hand a read to the blocking path, for errors the ring cannot explain
+		auto fallback = [&](size_t index)
+		{
+			if (reads[index].fd >= 0)
+				close(reads[index].fd);
+			reads[index] = {};
+			ReadBlocking(state, index);
+		};
+
+		while (next < count || inFlight > 0)
+		{
+			while (next < count && inFlight < URING_DEPTH)
+			{
+				size_t index = next++;
+				const std::string& path = state->entries[index].path;
+
+				//Packed files are already mapped
+				if (FileSystem::IsPacked(path))
+				{
+					ReadBlocking(state, index);
+					continue;
+				}
+
+				int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+				struct stat info;
+				if (fd < 0 || fstat(fd, &info) != 0)
+				{
+					if (fd >= 0)
+						close(fd);
+					Complete(state, index, {}, false);
+					continue;
+				}
+
+				if (info.st_size == 0)
+				{
+					close(fd);
+					Complete(state, index, FileData::FromBuffer({}), true);
+					continue;
+				}
+
+				PendingRead& read = reads[index];
+				read.fd = fd;
+				read.buffer.resize(static_cast<size_t>(info.st_size));
+				ring.PushRead(fd, read.buffer.data(), read.buffer.size(), 0, index);
+				inFlight++;
+			}
+
+			if (inFlight == 0)
+				continue;
+
+			if (!ring.SubmitAndWait())
+			{
+				//Ring is unusable, finish everything started on it the blocking way
+				for (size_t index = 0; index < next; index++)
+				{
+					if (reads[index].fd >= 0)
+						fallback(index);
+				}
+				for (; next < count; next++)
+					ReadBlocking(state, next);
+				return true;
+			}
+
+			io_uring_cqe cqe;
+			while (ring.PopCompletion(cqe))
+			{
+				inFlight--;
+				size_t index = static_cast<size_t>(cqe.user_data);
+				PendingRead& read = reads[index];
+
+				if (cqe.res <= 0)
+				{
+					fallback(index);
+					continue;
+				}
+
+				//Short reads continue from where they stopped
+				read.done += static_cast<size_t>(cqe.res);
+				if (read.done < read.buffer.size())
+				{
+					ring.PushRead(read.fd, read.buffer.data() + read.done, read.buffer.size() - read.done, read.done, index);
+					inFlight++;
+					continue;
+				}
+
+				close(read.fd);
+				read.fd = -1;
+				Complete(state, index, FileData::FromBuffer(std::move(read.buffer)), true);
+			}
+		}
+
+		return true;
+	}
+#endif
+
+	//Single owner of the ring for a batch, whoever gets here first drives all reads
+	static void Pump(const std::shared_ptr<ReadBatchState>& state)
+	{
+		if (state->pumpClaimed.exchange(true))
+			return;
+
+#ifdef TT_IO_URING
+		if (PumpUring(state))
+			return;
+#endif
+		while (ReadNext(state)) {}
+	}
+
+	ReadBatch::ReadBatch()
+		: m_State(std::make_shared<ReadBatchState>())
+	{
+	}
+
+	ReadBatch::~ReadBatch()
+	{
+		if (m_State->submitted)
+			Wait();
+	}
+
+	void ReadBatch::Add(const std::string& path, ReadCallback onComplete)
+	{
+		if (m_State->submitted)
+			return;
+
+		m_State->entries.push_back({ path, std::move(onComplete) });
+	}
+
+	void ReadBatch::Submit()
+	{
+		if (m_State->submitted)
+			return;
+
+		m_State->submitted = true;
+		m_State->remaining = m_State->entries.size();
+		m_State->useUring = AsyncIO::IsUringAvailable();
+
+		size_t workers = JobSystem::GetWorkerCount();
+		if (m_State->entries.empty())
+			return;
+
+		if (workers == 0)
+		{
+			Wait();
+			return;
+		}
+
+		std::shared_ptr<ReadBatchState> state = m_State;
+		if (m_State->useUring)
+		{
+			//One worker owns the ring, completions fan out to the rest
+			JobSystem::Submit([state]() { Pump(state); });
+		}
+		else
+		{
+			size_t readers = std::min(workers, m_State->entries.size());
+			for (size_t i = 0; i < readers; i++)
+				JobSystem::Submit([state]() { while (ReadNext(state)) {} });
+		}
+	}
+
+	void ReadBatch::Wait()
+	{
+		Submit();
+
+		while (true)
+		{
+			//Callbacks first so buffers do not pile up
+			if (RunCompletion(m_State))
+				continue;
+
+			if (m_State->useUring)
+				Pump(m_State);
+			else if (ReadNext(m_State))
+				continue;
+
+			std::unique_lock<std::mutex> lock(m_State->mutex);
+			if (m_State->remaining == 0)
+				break;
+
+			m_State->changed.wait(lock, [this]() { return m_State->remaining == 0 || !m_State->completions.empty(); });
+		}
+	}
+
+	void AsyncIO::Init()
+	{
+#ifdef TT_IO_URING
+		//Containers and older kernels can refuse the ring, the job system backend covers them
+		UringQueue probe;
+		s_Uring = probe.Init(URING_DEPTH);
+#endif
+
+		Log::Write(
+			LogLevel::Info,
+			LogCategory::Core,
+			std::string("Async file reads use ") + (s_Uring ? "io_uring" : "the job system")
+		);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+#pragma once
+#include <string>
+#include <memory>
+#include <functional>
+#include "Core/FileData.h"
+
+namespace EngineCore
+{
+	//Called once per file as soon as its bytes are in memory, on a job worker or inside Wait
+	using ReadCallback = std::function<void(const FileData& file, bool ok)>;
+
+	struct ReadBatchState;
+
+	//Reads issued together, io_uring on Linux and job system reads elsewhere
+	class ReadBatch
+	{
+	public:
+		ReadBatch();
+		~ReadBatch();	//Waits for anything still in flight
+
+		ReadBatch(const ReadBatch&) = delete;
+		ReadBatch& operator=(const ReadBatch&) = delete;
+
+		void Add(const std::string& path, ReadCallback onComplete);
+		void Submit();	//Starts every read and returns, runs the whole batch inline without workers
+		void Wait();	//Helps with reads and callbacks, returns when every callback has run
+	private:
+		std::shared_ptr<ReadBatchState> m_State;	//Shared with the jobs still running for this batch
+	};
+
+	class AsyncIO
+	{
+	public:
+		static void Init();	//Probes the io_uring backend, call after JobSystem::Init
+		static bool IsUringAvailable() { return s_Uring; }
+	private:
+		static bool s_Uring;
+	};
+}
\ No newline at end of file
@@ -1,13 +1,16 @@
 #pragma once
-#include <string>
-#include <vector>
+#include <string_view>
+#include <span>
+#include "Core/StringId.h"
 
 namespace EngineData
 {
+	//Views point into the library's arena or the mapped definition blob
 	struct AnimationData
 	{
-		std::string id;
-		std::string spritePath;
+		std::string_view id;
+		EngineCore::StringId key;	//Interned id, set by DataLibrary
+		std::string_view spritePath;
 
 		float frameW;
 		float frameH;
@@ -15,6 +18,6 @@ namespace EngineData
 		float frameTime;
 		bool loop;
 
-		std::vector<int> eventFrames;
+		std::span<const int> eventFrames;
 	};
-}
\ No newline at end of file
+}
@@ -1,28 +1,25 @@
 #pragma once
 #include "Core/Data/Animation/AnimationData.h"
-#include "json.hpp"
+#include "Core/Data/Schema.h"
 
 namespace EngineData
 {
-	class AnimationParser
+	template<>
+	struct Schema<AnimationData>
 	{
-	public:
-		static AnimationData Parse(const nlohmann::json& j)
-		{
-			AnimationData anim;
+		static constexpr DefinitionType BLOB_TYPE = DefinitionType::Animation;
 
-			anim.id = j.value("Id", "");
-			anim.spritePath = j.value("SpriteSheetPath", "");
-			anim.frameW = j.value("FrameWidth", 0.f);
-			anim.frameH = j.value("FrameHeight", 0.f);
-			anim.frameCount = j.value("FrameCount", 0);
-			anim.frameTime = j.value("FrameTime", 0.f);;
-			anim.loop = j.value("Loop", true);
-
-			if (j.contains("EventFrames"))
-				anim.eventFrames = j["EventFrames"].get<std::vector<int>>();
-
-			return anim;
-		}
+		static constexpr auto FIELDS = std::make_tuple(
+			MakeField("Id", &AnimationData::id, {}, FieldRule::Required),
+			MakeField("SpriteSheetPath", &AnimationData::spritePath, {}, FieldRule::Required),
+			MakeField("FrameWidth", &AnimationData::frameW, 0.f, FieldRule::Positive),
+			MakeField("FrameHeight", &AnimationData::frameH, 0.f, FieldRule::Positive),
+			MakeField("FrameCount", &AnimationData::frameCount, 0, FieldRule::Positive),
+			MakeField("FrameTime", &AnimationData::frameTime, 0.f, FieldRule::Positive),
+			MakeField("Loop", &AnimationData::loop, true),
+			MakeField("EventFrames", &AnimationData::eventFrames)
+		);
 	};
-}
\ No newline at end of file
+
+	using AnimationParser = SchemaParser<AnimationData>;
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include <string_view>
+#include <span>
+#include <vector>
+#include <memory>
+#include <cstring>
+#include <cstddef>
+#include <iterator>
+
+namespace EngineData
+{
+	//Bump allocator backing the string and array views of definition records
+	class DataArena
+	{
+	public:
+		void* Allocate(size_t size, size_t alignment)
+		{
+			size_t offset = (m_Used + alignment - 1) & ~(alignment - 1);
+			if (m_Blocks.empty() || offset + size > m_BlockSize)
+			{
+				//Oversized requests get a block of their own
+				m_BlockSize = size > BLOCK_SIZE ? size : BLOCK_SIZE;
+				m_Blocks.push_back(std::make_unique<std::byte[]>(m_BlockSize));
+				offset = 0;
+			}
+
+			m_Used = offset + size;
+			return m_Blocks.back().get() + offset;
+		}
+
+		std::string_view Store(std::string_view text)
+		{
+			if (text.empty())
+				return {};
+
+			char* data = static_cast<char*>(Allocate(text.size(), 1));
+			std::memcpy(data, text.data(), text.size());
+			return { data, text.size() };
+		}
+
+		template<typename T>
+		std::span<const T> StoreArray(std::span<const T> items)
+		{
+			if (items.empty())
+				return {};
+
+			T* data = static_cast<T*>(Allocate(items.size_bytes(), alignof(T)));
+			std::memcpy(static_cast<void*>(data), items.data(), items.size_bytes());
+			return { data, items.size() };
+		}
+
+		//Takes over another arena's blocks, views into them stay valid
+		void Adopt(DataArena&& other)
+		{
+			if (m_Blocks.empty())
+			{
+				m_Blocks = std::move(other.m_Blocks);
+				m_Used = other.m_Used;
+				m_BlockSize = other.m_BlockSize;
+			}
+			else
+			{
+				//Keep our partly used block last so allocation carries on in it
+				m_Blocks.insert(m_Blocks.end() - 1,
+					std::make_move_iterator(other.m_Blocks.begin()),
+					std::make_move_iterator(other.m_Blocks.end()));
+			}
+
+			other.Clear();
+		}
+
+		void Clear()
+		{
+			m_Blocks.clear();
+			m_Used = 0;
+			m_BlockSize = 0;
+		}
+	private:
+		static constexpr size_t BLOCK_SIZE = 16 * 1024;
+
+		std::vector<std::unique_ptr<std::byte[]>> m_Blocks;
+		size_t m_Used = 0;
+		size_t m_BlockSize = 0;
+	};
+}
\ No newline at end of file
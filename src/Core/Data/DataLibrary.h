@@ -1,10 +1,22 @@
 #pragma once
 #include <Core/JsonLoader.h>
-#include <unordered_map>
-#include <filesystem>
+#include "Core/FileSystem.h"
+#include "Core/AsyncIO.h"
+#include "Core/Log.h"
+#include "Core/StringId.h"
+#include "Core/Data/DataArena.h"
+#include "Core/Data/JsonRecordReader.h"
+#include "Core/Data/DefinitionBlob.h"
+#include <string_view>
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <memory>
 
 namespace EngineData
 {
+	//Records sorted by id in one dense vector, found through an open addressed index on the interned key
+	//String and array fields view into s_Arena (json) or s_Blob (cooked)
 	template<typename T, typename Parser>
 	class DataLibrary
 	{
@@ -12,65 +24,272 @@ namespace EngineData
 		//Load all json files in a folder
 		static bool LoadFromFolder(const std::string& path)
 		{
-			for (auto& file : std::filesystem::directory_iterator(path))
-			{
-				if (file.path().extension() != ".json")
-					continue;
+			EngineCore::ReadBatch batch;
+			QueueFolder(path, batch);
+			batch.Wait();
 
-				nlohmann::json j;
-				if (!EngineCore::JsonLoader::LoadFromFile(file.path().string(), j))
-					continue;
+			Merge();
+			return true;
+		}
 
-				T data = Parser::Parse(j);
+		//Load all datas in a json file
+		static bool LoadFromFile(const std::string& path)
+		{
+			EngineCore::ReadBatch batch;
+			QueueFile(path, batch);
+			batch.Wait();
 
-				if (data.id.empty())
-					continue;
+			return Merge();
+		}
 
-				if (s_Data.contains(data.id))
-				{
-					//duplicate warning
-				}
+		//Batched loading, each file parses on its own as its read completes, Merge once the batch is done
+		static void QueueFolder(const std::string& path, EngineCore::ReadBatch& batch)
+		{
+			for (const auto& file : EngineCore::FileSystem::List(path, ".json"))
+				QueueFile(file, batch, path);
+		}
+
+		static void QueueFile(const std::string& path, EngineCore::ReadBatch& batch)
+		{
+			QueueFile(path, batch, path);
+		}
 
-				s_Data[data.id] = data;
+		//Adds the parsed files in the order they were queued, false if any of them failed
+		static bool Merge()
+		{
+			bool loaded = true;
+			std::string source;
+
+			for (auto& pending : s_Pending)
+			{
+				loaded &= pending->loaded;
+				source = pending->source;
+
+				s_Records.insert(s_Records.end(), std::make_move_iterator(pending->records.begin()), std::make_move_iterator(pending->records.end()));
+				s_Arena.Adopt(std::move(pending->arena));
 			}
 
+			s_Pending.clear();
+			Finalize(source);
+			return loaded;
+		}
+
+		//Cooked records, no parsing and one allocation for the whole table
+		static bool LoadFromBlob(const DefinitionBlob& blob)
+		{
+			auto records = blob.template GetRecords<typename Parser::Record>(Parser::BLOB_TYPE);
+
+			s_Blob = blob;
+			s_Records.reserve(s_Records.size() + records.size());
+			for (const auto& record : records)
+				s_Records.push_back(Parser::FromRecord(record, s_Blob, s_Arena));
+
+			Finalize(DEFINITIONS_FILE);
 			return true;
 		}
 
-		//Load all datas in a json file
-		static bool LoadFromFile(const std::string& path)
+		//Hot reload, records already in the library are overwritten in place so pointers to them stay valid
+		//Ids the file adds are left for the next start, nothing running can refer to them yet
+		static bool ReloadFile(const std::string& path, std::vector<EngineCore::StringId>& outChanged)
 		{
-			nlohmann::json j;
-			if (!EngineCore::JsonLoader::LoadFromFile(path, j))
+			std::vector<T> records;
+			DataArena arena;
+			JsonRecordReader<T, Parser> reader(records, arena);
+			if (!EngineCore::JsonLoader::Parse(path, reader))
 				return false;
 
-			if (!j.is_array())
+			Replace(records, std::move(arena), path, outChanged);
+			return true;
+		}
+
+		//Live link, the same in place overwrite for records sent as json text, source names them in logs
+		static bool ReloadText(std::string_view json, const std::string& source, std::vector<EngineCore::StringId>& outChanged)
+		{
+			std::vector<T> records;
+			DataArena arena;
+			JsonRecordReader<T, Parser> reader(records, arena);
+			EngineCore::FileData file = EngineCore::FileData::FromBuffer(std::vector<uint8_t>(json.begin(), json.end()));
+			if (!EngineCore::JsonLoader::Parse(source, file, reader))
 				return false;
 
-			for (auto& item : j)
+			Replace(records, std::move(arena), source, outChanged);
+			return true;
+		}
+
+		static const T* Get(EngineCore::StringId key)
+		{
+			return Find(key);
+		}
+
+		//Text ids from maps and other definitions, a hash match is confirmed against the text
+		static const T* Get(std::string_view id)
+		{
+			const T* data = Get(EngineCore::StringId(id));
+			return data && data->id == id ? data : nullptr;
+		}
+
+		static const std::vector<T>& GetAll() { return s_Records; }
+
+		static void Clear()
+		{
+			s_Records.clear();
+			s_Index.clear();
+			s_Arena.Clear();
+			s_Blob = {};
+		}
+
+	private:
+		struct PendingFile
+		{
+			std::string path;
+			std::string source;	//Folder or file named in duplicate warnings
+			std::vector<T> records;
+			DataArena arena;
+			bool loaded = false;
+		};
+
+		static void QueueFile(const std::string& path, EngineCore::ReadBatch& batch, const std::string& source)
+		{
+			PendingFile* pending = s_Pending.emplace_back(std::make_unique<PendingFile>()).get();
+			pending->path = path;
+			pending->source = source;
+
+			batch.Add(path, [pending](const EngineCore::FileData& file, bool ok)
 			{
-				T data = Parser::Parse(item);
+				if (!ok)
+				{
+					EngineCore::Log::Write(
+						EngineCore::LogLevel::Error,
+						EngineCore::LogCategory::Core,
+						"Failed to open json file :" + pending->path
+					);
+					return;
+				}
 
-				if (data.id.empty())
+				JsonRecordReader<T, Parser> reader(pending->records, pending->arena);
+				pending->loaded = EngineCore::JsonLoader::Parse(pending->path, file, reader);
+			});
+		}
+
+		static void Replace(std::vector<T>& records, DataArena&& arena, const std::string& source, std::vector<EngineCore::StringId>& outChanged)
+		{
+			for (auto& record : records)
+			{
+				if (record.id.empty())
 					continue;
 
-				s_Data[data.id] = data;
+				record.key = EngineCore::StringTable::Intern(record.id);
+				T* existing = Find(record.key);
+				if (!existing)
+				{
+					EngineCore::Log::Write(
+						EngineCore::LogLevel::Info,
+						EngineCore::LogCategory::Core,
+						"New definition '" + std::string(record.id) + "' in " + source + " is loaded on the next start"
+					);
+					continue;
+				}
+
+				*existing = record;
+				Validate(*existing, source);
+				outChanged.push_back(record.key);
 			}
 
-			return true;
+			s_Arena.Adopt(std::move(arena));
 		}
 
-		static const T* Get(const std::string& id)
+		//Later definitions replace earlier ones with the same id
+		static void Finalize(std::string_view source)
 		{
-			auto it = s_Data.find(id);
-			if (it != s_Data.end())
-				return &it->second;
+			std::erase_if(s_Records, [](const T& data) { return data.id.empty(); });
+
+			std::stable_sort(s_Records.begin(), s_Records.end(), [](const T& a, const T& b)
+			{
+				return a.id < b.id;
+			});
+
+			auto last = s_Records.begin();
+			for (auto it = s_Records.begin(); it != s_Records.end(); ++it)
+			{
+				if (last != s_Records.begin() && (last - 1)->id == it->id)
+				{
+					EngineCore::Log::Write(
+						EngineCore::LogLevel::Warning,
+						EngineCore::LogCategory::Core,
+						"Duplicate definition id '" + std::string(it->id) + "' in " + std::string(source) + ", the later one is used"
+					);
+					*(last - 1) = std::move(*it);
+				}
+				else
+					*last++ = std::move(*it);
+			}
+
+			s_Records.erase(last, s_Records.end());
+
+			for (auto& data : s_Records)
+				data.key = EngineCore::StringTable::Intern(data.id);
+			BuildIndex();
+
+			for (const auto& data : s_Records)
+				Validate(data, source);
+		}
+
+		//Broken fields are reported, the record is still kept
+		static void Validate(const T& data, std::string_view source)
+		{
+			std::vector<std::string> errors;
+			if (Parser::Validate(data, errors))
+				return;
+
+			for (const auto& error : errors)
+			{
+				EngineCore::Log::Write(
+					EngineCore::LogLevel::Warning,
+					EngineCore::LogCategory::Core,
+					"Definition '" + std::string(data.id) + "' in " + std::string(source) + " : " + error
+				);
+			}
+		}
+
+		static T* Find(EngineCore::StringId key)
+		{
+			if (s_Index.empty())
+				return nullptr;
+
+			size_t mask = s_Index.size() - 1;
+			for (size_t slot = key.value & mask; s_Index[slot] != 0; slot = (slot + 1) & mask)
+			{
+				T& data = s_Records[s_Index[slot] - 1];
+				if (data.key == key)
+					return &data;
+			}
+
 			return nullptr;
 		}
 
-		static void Clear() { s_Data.clear(); }
+		//Power of two slots at most half full, each holds a record index + 1, 0 is empty
+		static void BuildIndex()
+		{
+			size_t capacity = 16;
+			while (capacity < s_Records.size() * 2)
+				capacity *= 2;
 
-	private:
-		static inline std::unordered_map<std::string, T> s_Data;
+			s_Index.assign(capacity, 0);
+			size_t mask = capacity - 1;
+			for (size_t i = 0; i < s_Records.size(); i++)
+			{
+				size_t slot = s_Records[i].key.value & mask;
+				while (s_Index[slot] != 0)
+					slot = (slot + 1) & mask;
+
+				s_Index[slot] = static_cast<uint32_t>(i + 1);
+			}
+		}
+
+		static inline std::vector<T> s_Records;
+		static inline std::vector<uint32_t> s_Index;
+		static inline DataArena s_Arena;
+		static inline DefinitionBlob s_Blob;
+		static inline std::vector<std::unique_ptr<PendingFile>> s_Pending;	//Queued, filled by batch callbacks
 	};
-}
\ No newline at end of file
+}
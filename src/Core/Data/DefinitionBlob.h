@@ -0,0 +1,127 @@
+#pragma once
+#include <string_view>
+#include <span>
+#include <cstdint>
+#include "Core/FileData.h"
+
+namespace EngineData
+{
+	//.ttdefs layout: header, section table, records, array area, string table
+	constexpr uint32_t DEFS_MAGIC = 0x46445454;	//"TTDF"
+	constexpr uint32_t DEFS_VERSION = 1;
+	constexpr const char* DEFINITIONS_FILE = "Definitions.ttdefs";	//Under Assets/Data
+
+	enum class DefinitionType : uint32_t
+	{
+		Animation = 1,
+		Entity,
+		Interactable,
+		Trap
+	};
+
+	struct BlobString
+	{
+		uint32_t offset;
+		uint32_t length;
+	};
+
+	struct BlobArray
+	{
+		uint32_t offset;	//Bytes into the array area
+		uint32_t count;
+	};
+
+	struct DefinitionHeader
+	{
+		uint32_t magic;
+		uint32_t version;
+		uint32_t sectionCount;
+		uint32_t reserved;
+		uint64_t arraysOffset;
+		uint64_t arraysSize;
+		uint64_t stringsOffset;
+		uint64_t stringsSize;
+	};
+
+	struct DefinitionSection
+	{
+		DefinitionType type;
+		uint32_t recordSize;
+		uint32_t recordCount;	//Sorted by id
+		uint32_t reserved;
+		uint64_t recordsOffset;
+	};
+
+	//Read side, every accessor is a bounds checked view into the file
+	class DefinitionBlob
+	{
+	public:
+		bool Open(EngineCore::FileData data)
+		{
+			if (data.GetSize() < sizeof(DefinitionHeader))
+				return false;
+
+			const auto* header = reinterpret_cast<const DefinitionHeader*>(data.GetData());
+			uint64_t sectionsEnd = sizeof(DefinitionHeader) + uint64_t(header->sectionCount) * sizeof(DefinitionSection);
+
+			if (header->magic != DEFS_MAGIC || header->version != DEFS_VERSION ||
+				sectionsEnd > data.GetSize() ||
+				header->arraysOffset + header->arraysSize > data.GetSize() ||
+				header->stringsOffset + header->stringsSize > data.GetSize())
+				return false;
+
+			for (const auto& section : GetSections(header))
+			{
+				if (section.recordsOffset + uint64_t(section.recordSize) * section.recordCount > data.GetSize())
+					return false;
+			}
+
+			m_Header = header;
+			m_Data = std::move(data);
+			return true;
+		}
+
+		bool IsOpen() const { return m_Header != nullptr; }
+
+		template<typename Record>
+		std::span<const Record> GetRecords(DefinitionType type) const
+		{
+			if (!m_Header)
+				return {};
+
+			for (const auto& section : GetSections(m_Header))
+			{
+				//A record size mismatch means the blob was cooked by another engine version
+				if (section.type == type && section.recordSize == sizeof(Record))
+					return { reinterpret_cast<const Record*>(m_Data.GetData() + section.recordsOffset), section.recordCount };
+			}
+
+			return {};
+		}
+
+		std::string_view GetString(BlobString str) const
+		{
+			if (!m_Header || uint64_t(str.offset) + str.length > m_Header->stringsSize)
+				return {};
+
+			return { reinterpret_cast<const char*>(m_Data.GetData() + m_Header->stringsOffset + str.offset), str.length };
+		}
+
+		template<typename T>
+		std::span<const T> GetArray(BlobArray array) const
+		{
+			if (!m_Header || uint64_t(array.offset) + uint64_t(array.count) * sizeof(T) > m_Header->arraysSize)
+				return {};
+
+			return { reinterpret_cast<const T*>(m_Data.GetData() + m_Header->arraysOffset + array.offset), array.count };
+		}
+	private:
+		std::span<const DefinitionSection> GetSections(const DefinitionHeader* header) const
+		{
+			return { reinterpret_cast<const DefinitionSection*>(header + 1), header->sectionCount };
+		}
+
+		EngineCore::FileData m_Data;
+		const DefinitionHeader* m_Header = nullptr;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,116 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <span>
+#include <vector>
+#include <unordered_map>
+#include <cstring>
+#include "Core/Data/DefinitionBlob.h"
+
+namespace EngineData
+{
+	//Cook side of DefinitionBlob
+	class DefinitionWriter
+	{
+	public:
+		BlobString AddString(std::string_view text)
+		{
+			auto it = m_StringOffsets.find(std::string(text));
+			if (it != m_StringOffsets.end())
+				return { it->second, static_cast<uint32_t>(text.size()) };
+
+			uint32_t offset = static_cast<uint32_t>(m_Strings.size());
+			m_Strings.append(text);
+			m_StringOffsets.emplace(std::string(text), offset);
+			return { offset, static_cast<uint32_t>(text.size()) };
+		}
+
+		template<typename T>
+		BlobArray AddArray(std::span<const T> items)
+		{
+			if (items.empty())
+				return { 0, 0 };
+
+			size_t offset = (m_Arrays.size() + alignof(T) - 1) & ~(alignof(T) - 1);
+			m_Arrays.resize(offset + items.size_bytes());
+			std::memcpy(m_Arrays.data() + offset, items.data(), items.size_bytes());
+			return { static_cast<uint32_t>(offset), static_cast<uint32_t>(items.size()) };
+		}
+
+		//Records must already be sorted by id
+		template<typename Record>
+		void AddSection(DefinitionType type, const std::vector<Record>& records)
+		{
+			Section section;
+			section.type = type;
+			section.recordSize = sizeof(Record);
+			section.recordCount = static_cast<uint32_t>(records.size());
+			section.bytes.resize(records.size() * sizeof(Record));
+			if (!records.empty())
+				std::memcpy(section.bytes.data(), records.data(), section.bytes.size());
+
+			m_Sections.push_back(std::move(section));
+		}
+
+		std::vector<uint8_t> Build() const
+		{
+			auto align = [](uint64_t offset) { return (offset + 7) & ~uint64_t(7); };
+
+			DefinitionHeader header{};
+			header.magic = DEFS_MAGIC;
+			header.version = DEFS_VERSION;
+			header.sectionCount = static_cast<uint32_t>(m_Sections.size());
+
+			uint64_t offset = sizeof(DefinitionHeader) + m_Sections.size() * sizeof(DefinitionSection);
+			std::vector<DefinitionSection> table;
+			for (const auto& section : m_Sections)
+			{
+				offset = align(offset);
+
+				DefinitionSection entry{};
+				entry.type = section.type;
+				entry.recordSize = section.recordSize;
+				entry.recordCount = section.recordCount;
+				entry.recordsOffset = offset;
+				table.push_back(entry);
+
+				offset += section.bytes.size();
+			}
+
+			header.arraysOffset = align(offset);
+			header.arraysSize = m_Arrays.size();
+			header.stringsOffset = header.arraysOffset + header.arraysSize;
+			header.stringsSize = m_Strings.size();
+
+			std::vector<uint8_t> bytes(static_cast<size_t>(header.stringsOffset + header.stringsSize), 0);
+			std::memcpy(bytes.data(), &header, sizeof(header));
+			if (!table.empty())
+				std::memcpy(bytes.data() + sizeof(header), table.data(), table.size() * sizeof(DefinitionSection));
+
+			for (size_t i = 0; i < m_Sections.size(); i++)
+			{
+				if (!m_Sections[i].bytes.empty())
+					std::memcpy(bytes.data() + table[i].recordsOffset, m_Sections[i].bytes.data(), m_Sections[i].bytes.size());
+			}
+
+			if (!m_Arrays.empty())
+				std::memcpy(bytes.data() + header.arraysOffset, m_Arrays.data(), m_Arrays.size());
+			std::memcpy(bytes.data() + header.stringsOffset, m_Strings.data(), m_Strings.size());
+
+			return bytes;
+		}
+	private:
+		struct Section
+		{
+			DefinitionType type;
+			uint32_t recordSize;
+			uint32_t recordCount;
+			std::vector<uint8_t> bytes;
+		};
+
+		std::vector<Section> m_Sections;
+		std::vector<uint8_t> m_Arrays;
+		std::string m_Strings;
+		std::unordered_map<std::string, uint32_t> m_StringOffsets;
+	};
+}
\ No newline at end of file
@@ -1,20 +1,22 @@
 #pragma once
-#include <string>
-#include <vector>
+#include <string_view>
+#include <span>
+#include "Core/StringId.h"
 
 namespace EngineData
 {
 	struct EntityData
 	{
-		std::string id;
+		std::string_view id;
+		EngineCore::StringId key;	//Interned id, set by DataLibrary
 		float speed;
 		float attackDamage;
 		float attackInterval;
 		float maxHp;
-		std::string idleAnim;
-		std::string walkAnim;
-		std::string hurtAnim;
-		std::string deathAnim;
-		std::vector<std::string> attackAnims;
+		std::string_view idleAnim;
+		std::string_view walkAnim;
+		std::string_view hurtAnim;
+		std::string_view deathAnim;
+		std::span<const std::string_view> attackAnims;
 	};
-}
\ No newline at end of file
+}
@@ -1,32 +1,27 @@
 #pragma once
 #include "Core/Data/Entity/EntityData.h"
-#include "json.hpp"
+#include "Core/Data/Schema.h"
 
 namespace EngineData
 {
-	class EntityParser
+	template<>
+	struct Schema<EntityData>
 	{
-	public:
-		static EntityData Parse(const nlohmann::json& j)
-		{
-			EntityData entity;
+		static constexpr DefinitionType BLOB_TYPE = DefinitionType::Entity;
 
-			entity.id = j.value("Id", "");
-
-			entity.speed = j.value("Speed", 0.f);
-			entity.attackDamage = j.value("AttackDamage", 0.f);
-			entity.attackInterval = j.value("AttackInterval", 0.f);
-			entity.maxHp = j.value("MaxHP", 0.f);
-
-			entity.idleAnim = j.value("IdleAnimation", "");
-			entity.walkAnim = j.value("WalkAnimation", "");
-			entity.hurtAnim = j.value("HurtAnimation", "");
-			entity.deathAnim = j.value("DeathAnimation", "");
-
-			if (j.contains("AttackAnimations") && j["AttackAnimations"].is_array())
-				entity.attackAnims = j["AttackAnimations"].get<std::vector<std::string>>();
-
-			return entity;
-		}
+		static constexpr auto FIELDS = std::make_tuple(
+			MakeField("Id", &EntityData::id, {}, FieldRule::Required),
+			MakeField("Speed", &EntityData::speed, 0.f, FieldRule::NonNegative),
+			MakeField("AttackDamage", &EntityData::attackDamage, 0.f, FieldRule::NonNegative),
+			MakeField("AttackInterval", &EntityData::attackInterval, 0.f, FieldRule::NonNegative),
+			MakeField("MaxHP", &EntityData::maxHp, 0.f, FieldRule::Positive),
+			MakeField("IdleAnimation", &EntityData::idleAnim),
+			MakeField("WalkAnimation", &EntityData::walkAnim),
+			MakeField("HurtAnimation", &EntityData::hurtAnim),
+			MakeField("DeathAnimation", &EntityData::deathAnim),
+			MakeField("AttackAnimations", &EntityData::attackAnims)
+		);
 	};
-}
\ No newline at end of file
+
+	using EntityParser = SchemaParser<EntityData>;
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+namespace EngineData
+{
+	//Movement values the entities start with, shared with the tools that reason about where they can go
+	constexpr float ENTITY_GRAVITY = 200.0f;
+	constexpr float ENTITY_MAX_FALL_SPEED = 800.0f;
+	constexpr float ENTITY_COLLIDER_WIDTH = 32.0f;
+	constexpr float ENTITY_COLLIDER_HEIGHT = 64.0f;
+	constexpr float PLAYER_JUMP_FORCE = 200.0f;
+}
\ No newline at end of file
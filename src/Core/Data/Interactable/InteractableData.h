@@ -1,12 +1,14 @@
 #pragma once
-#include <string>
+#include <string_view>
+#include "Core/StringId.h"
 
 namespace EngineData
 {
 	struct InteractableData
 	{
-		std::string id;
-		std::string type;
-		std::string imagePath;
+		std::string_view id;
+		EngineCore::StringId key;	//Interned id, set by DataLibrary
+		std::string_view type;
+		std::string_view imagePath;
 	};
-}
\ No newline at end of file
+}
@@ -1,22 +1,20 @@
 #pragma once
 #include "Core/Data/Interactable/InteractableData.h"
-#include "json.hpp"
-
+#include "Core/Data/Schema.h"
 
 namespace EngineData
 {
-	class InteractableParser
+	template<>
+	struct Schema<InteractableData>
 	{
-	public:
-		static InteractableData Parse(const nlohmann::json& j)
-		{
-			InteractableData interactable;
-
-			interactable.id = j.value("Id", "");
-			interactable.type = j.value("Type", "");
-			interactable.imagePath = j.value("ImagePath", "");
+		static constexpr DefinitionType BLOB_TYPE = DefinitionType::Interactable;
 
-			return interactable;
-		}
+		static constexpr auto FIELDS = std::make_tuple(
+			MakeField("Id", &InteractableData::id, {}, FieldRule::Required),
+			MakeField("Type", &InteractableData::type, {}, FieldRule::Required),
+			MakeField("ImagePath", &InteractableData::imagePath, {}, FieldRule::Required)
+		);
 	};
-}
\ No newline at end of file
+
+	using InteractableParser = SchemaParser<InteractableData>;
+}
@@ -1,30 +1,29 @@
 #pragma once
 #include "Core/Data/Interactable/TrapData.h"
-#include "json.hpp"
+#include "Core/Data/Schema.h"
 
 namespace EngineData
 {
-	class TrapParser
+	template<>
+	struct Schema<TrapData>
 	{
-	public:
-		static TrapData Parse(const nlohmann::json& j)
-		{
-			TrapData trap;
+		static constexpr DefinitionType BLOB_TYPE = DefinitionType::Trap;
 
-			trap.id = j.value("Id", "");
-			trap.imagePath = j.value("ImagePath", "");
-
-			//Saw Data
-			trap.speed = j.value("Speed", 0.f);
-			trap.damage = j.value("Damage", 0.f);
-			trap.damageCooldown = j.value("DamageCooldown", 0.f);
+		static constexpr auto FIELDS = std::make_tuple(
+			MakeField("Id", &TrapData::id, {}, FieldRule::Required),
+			MakeField("ImagePath", &TrapData::imagePath, {}, FieldRule::Required),
 
 			//Fire Data
-			trap.activeDuration = j.value("ActiveDuration", 0.f);
-			trap.inactiveDuration = j.value("InactiveDuration", 0.f);
-			trap.damagePerSecond = j.value("DamagePerSecond", 0.f);
+			MakeField("ActiveDuration", &TrapData::activeDuration, 0.f, FieldRule::NonNegative),
+			MakeField("InactiveDuration", &TrapData::inactiveDuration, 0.f, FieldRule::NonNegative),
+			MakeField("DamagePerSecond", &TrapData::damagePerSecond, 0.f, FieldRule::NonNegative),
 
-			return trap;
-		}
+			//Saw Data
+			MakeField("Speed", &TrapData::speed, 0.f, FieldRule::NonNegative),
+			MakeField("Damage", &TrapData::damage, 0.f, FieldRule::NonNegative),
+			MakeField("DamageCooldown", &TrapData::damageCooldown, 0.f, FieldRule::NonNegative)
+		);
 	};
+
+	using TrapParser = SchemaParser<TrapData>;
 }
\ No newline at end of file
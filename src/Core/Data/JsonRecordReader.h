@@ -0,0 +1,106 @@
+#pragma once
+#include "Core/JsonSax.h"
+#include "Core/Data/DataArena.h"
+#include <vector>
+
+namespace EngineData
+{
+	//Streams flat definition objects straight into records, the root is one object or an array of them,
+	//or with listKey the array stored under that key of the root object
+	//Parser supplies Default(), ReadField(record, key, value, arena) and ReadArray(record, key, values, arena)
+	template<typename T, typename Parser>
+	class JsonRecordReader : public EngineCore::JsonSaxHandler
+	{
+	public:
+		JsonRecordReader(std::vector<T>& outRecords, DataArena& arena, std::string_view listKey = {})
+			: m_Records(outRecords), m_Arena(arena), m_ListKey(listKey) {}
+	protected:
+		bool OnStartObject() override
+		{
+			if (IsRecordStart())
+			{
+				m_Record = Parser::Default();
+				m_RecordDepth = GetDepth();
+			}
+			return true;
+		}
+
+		bool OnEndObject() override
+		{
+			if (GetDepth() == m_RecordDepth)
+			{
+				m_Records.push_back(m_Record);
+				m_RecordDepth = 0;
+			}
+			return true;
+		}
+
+		bool OnStartArray() override
+		{
+			if (m_RecordDepth != 0 && GetDepth() == m_RecordDepth + 1)
+			{
+				m_ArrayKey = GetScopeKey(GetDepth());
+				m_ArrayValues.clear();
+				m_ArrayText.clear();
+			}
+			return true;
+		}
+
+		bool OnEndArray() override
+		{
+			if (m_RecordDepth != 0 && GetDepth() == m_RecordDepth + 1)
+			{
+				//Strings were copied out of the parser, point them at the kept text now it stops growing
+				size_t offset = 0;
+				for (auto& value : m_ArrayValues)
+				{
+					if (value.kind != EngineCore::JsonScalar::Kind::String)
+						continue;
+
+					value.text = std::string_view(m_ArrayText).substr(offset, value.text.size());
+					offset += value.text.size();
+				}
+
+				Parser::ReadArray(m_Record, m_ArrayKey, m_ArrayValues, m_Arena);
+			}
+			return true;
+		}
+
+		bool OnValue(const EngineCore::JsonScalar& value) override
+		{
+			if (m_RecordDepth == 0)
+				return true;
+
+			if (GetDepth() == m_RecordDepth)
+				Parser::ReadField(m_Record, GetKey(), value, m_Arena);
+			else if (GetDepth() == m_RecordDepth + 1 && IsArrayScope(GetDepth()))
+			{
+				m_ArrayValues.push_back(value);
+				if (value.kind == EngineCore::JsonScalar::Kind::String)
+					m_ArrayText += value.text;
+			}
+
+			return true;
+		}
+	private:
+		bool IsRecordStart() const
+		{
+			if (!m_ListKey.empty())
+				return GetDepth() == 3 && IsArrayScope(2) && GetScopeKey(2) == m_ListKey;
+
+			//Root object or an item of the root array
+			return GetDepth() == 1 || (GetDepth() == 2 && IsArrayScope(1));
+		}
+
+		std::vector<T>& m_Records;
+		DataArena& m_Arena;
+		std::string m_ListKey;
+
+		T m_Record{};
+		size_t m_RecordDepth = 0;
+
+		std::string m_ArrayKey;
+		std::vector<EngineCore::JsonScalar> m_ArrayValues;
+		std::string m_ArrayText;
+	};
+}
\ No newline at end of file
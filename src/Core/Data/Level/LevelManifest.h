@@ -0,0 +1,14 @@
+#pragma once
+#include <string>
+#include <vector>
+
+namespace EngineData
+{
+	//Everything a level touches, loaded before the level starts playing
+	struct LevelManifest
+	{
+		std::vector<std::string> animations;	//Animation definition ids
+		std::vector<std::string> textures;		//Sprite sheets, tiles, trap and interactable images
+		std::vector<std::string> fonts;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,19 @@
+#pragma once
+#include "Core/Data/Level/LevelManifest.h"
+#include "Core/Data/Schema.h"
+
+namespace EngineData
+{
+	//Cooked Maps/<map>.deps.json, texture and font paths are relative to Assets
+	template<>
+	struct Schema<LevelManifest>
+	{
+		static constexpr auto FIELDS = std::make_tuple(
+			MakeField("Animations", &LevelManifest::animations),
+			MakeField("Textures", &LevelManifest::textures),
+			MakeField("Fonts", &LevelManifest::fonts)
+		);
+	};
+
+	using LevelManifestParser = SchemaParser<LevelManifest>;
+}
\ No newline at end of file
@@ -1,31 +1,19 @@
 #pragma once
 #include "Core/Data/Level/LevelData.h"
-#include "json.hpp"
+#include "Core/Data/Schema.h"
 
 namespace EngineData
 {
-	class LevelParser
+	//Items of the "Levels" array in Levels.json
+	template<>
+	struct Schema<LevelData>
 	{
-	public:
-		static bool Parse(const nlohmann::json& j, std::vector<LevelData>& outLevel)
-		{
-			if (!j.contains("Levels") && !j["Levels"].is_array())
-				return false;
-
-			for (auto& l : j["Levels"])
-			{
-				LevelData data;
-				data.id = l.value("Id", "");
-				data.mapId = l.value("MapId", "");
-				data.IsActive = l.value("IsActive", false);
-
-				if (data.IsActive)
-				{
-					outLevel.push_back(data);
-				}
-			}
-
-			return true;
-		}
+		static constexpr auto FIELDS = std::make_tuple(
+			MakeField("Id", &LevelData::id, {}, FieldRule::Required),
+			MakeField("MapId", &LevelData::mapId, {}, FieldRule::Required),
+			MakeField("IsActive", &LevelData::IsActive, false)
+		);
 	};
+
+	using LevelParser = SchemaParser<LevelData>;
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 #include <string>
 #include <vector>
+#include "Core/FileData.h"
 
 namespace EngineData
 {
@@ -16,10 +17,10 @@ namespace EngineData
 		int w;
 		int h;
 		int tSize;
-		std::vector<int> tiles;
+		EngineCore::FileData tiles;	//One byte per cell, a view into the .ttmap when loaded from binary
 
 		std::vector<SpawnData> spawns;
 		std::vector<SpawnData> interactables;
 		std::vector<SpawnData> traps;
 	};
-}
\ No newline at end of file
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include <cstdint>
+
+namespace EngineData
+{
+	//.ttmap layout: header, 8-bit collision layer, spawn tables, string table
+	constexpr uint32_t MAP_MAGIC = 0x504D5454;	//"TTMP"
+	constexpr uint32_t MAP_VERSION = 1;
+
+	struct MapFileHeader
+	{
+		uint32_t magic;
+		uint32_t version;
+		int32_t width;
+		int32_t height;
+		int32_t tileSize;
+		uint32_t spawnCount;			//Player first, then enemies
+		uint32_t interactableCount;
+		uint32_t trapCount;
+		uint64_t tilesOffset;			//uint8_t[width * height]
+		uint64_t spawnsOffset;			//MapFileSpawn[spawnCount + interactableCount + trapCount]
+		uint64_t stringsOffset;
+		uint64_t stringsSize;
+	};
+
+	struct MapFileSpawn
+	{
+		float x;
+		float y;
+		uint32_t defOffset;				//Into the string table, not null terminated
+		uint32_t defLength;
+	};
+}
\ No newline at end of file
@@ -1,84 +1,141 @@
 #pragma once
 #include "Core/Data/Map/MapData.h"
-#include "json.hpp"
+#include "Core/Data/Schema.h"
+#include "Core/JsonSax.h"
 
 namespace EngineData
 {
-	class MapParser
+	//Map basics, the layers and spawn lists are streamed by hand below
+	template<>
+	struct Schema<MapData>
+	{
+		static constexpr auto FIELDS = std::make_tuple(
+			MakeField("Width", &MapData::w, 0, FieldRule::Positive),
+			MakeField("Height", &MapData::h, 0, FieldRule::Positive),
+			MakeField("TileSize", &MapData::tSize, 0, FieldRule::Positive)
+		);
+	};
+
+	template<>
+	struct Schema<SpawnData>
+	{
+		static constexpr auto FIELDS = std::make_tuple(
+			MakeField("X", &SpawnData::x),
+			MakeField("Y", &SpawnData::y),
+			MakeField("DefinitionId", &SpawnData::defId)
+		);
+	};
+
+	//Streams a map json into MapData, collision cells go straight into the final tile buffer
+	class MapParser : public EngineCore::JsonSaxHandler
 	{
 	public:
-		static bool Parse(const nlohmann::json& j, MapData& outMap)
+		explicit MapParser(MapData& outMap)
+			: m_Map(outMap)
 		{
-			//Parsing map basics
-			outMap.w = j.value("Width", 0);
-			outMap.h = j.value("Height", 0);
-			outMap.tSize = j.value("TileSize", 0);
+			m_Map.w = 0;
+			m_Map.h = 0;
+			m_Map.tSize = 0;
+			m_Map.spawns.clear();
+			m_Map.interactables.clear();
+			m_Map.traps.clear();
+		}
 
-			if (!j.contains("Layers") || !j["Layers"].contains("Collision"))
-				return false;
+		//Call after Parse, checks the basics and the collision layer against the map size
+		bool Finish()
+		{
+			std::vector<std::string> errors;
+			if (!SchemaParser<MapData>::Validate(m_Map, errors))
+				return Fail(errors.front());
 
-			outMap.tiles = j["Layers"]["Collision"].get<std::vector<int>>();
+			if (!m_HasCollision || (int64_t)m_Tiles.size() != (int64_t)m_Map.w * m_Map.h)
+				return Fail("Collision layer does not match map size");
 
-			if ((int)outMap.tiles.size() != outMap.w * outMap.h)
-				return false;
+			m_Map.tiles = EngineCore::FileData::FromBuffer(std::move(m_Tiles));
 
-			//Parsing Interactables-Traps
-			outMap.interactables.clear();
-			if (j.contains("Interactables"))
+			//Player spawn always leads the list whatever the key order
+			m_Map.spawns.insert(m_Map.spawns.begin(), m_Player.begin(), m_Player.end());
+			return true;
+		}
+	protected:
+		bool OnStartArray() override
+		{
+			//Layers.Collision
+			if (GetDepth() == 3 && GetScopeKey(2) == "Layers" && GetScopeKey(3) == "Collision")
 			{
-				for (auto& i : j["Interactables"])
-				{
-					SpawnData d;
-					d.x = i.value("X", 0.f);
-					d.y = i.value("Y", 0.f);
-					d.defId = i.value("DefinitionId", "");
-
-					outMap.interactables.push_back(d);
-				}
+				m_InCollision = true;
+				m_HasCollision = true;
+				if (m_Map.w > 0 && m_Map.h > 0)
+					m_Tiles.reserve((size_t)m_Map.w * m_Map.h);
 			}
+			return true;
+		}
 
-			outMap.traps.clear();
-			if (j.contains("Traps"))
-			{
-				for (auto& i : j["Traps"])
-				{
-					SpawnData d;
-					d.x = i.value("X", 0.f);
-					d.y = i.value("Y", 0.f);
-					d.defId = i.value("DefinitionId", "");
-
-					outMap.traps.push_back(d);
-				}
-			}
+		bool OnEndArray() override
+		{
+			m_InCollision = false;
+			return true;
+		}
+
+		bool OnStartObject() override
+		{
+			m_Spawn = nullptr;
 
 			//Parsing Entities
-			outMap.spawns.clear();
-			if (j.contains("PlayerSpawn"))
+			if (GetDepth() == 2 && GetScopeKey(2) == "PlayerSpawn")
+				m_Spawn = &m_Player;
+
+			//Parsing Interactables-Traps-Enemies
+			if (GetDepth() == 3 && IsArrayScope(2))
 			{
-				auto& p = j["PlayerSpawn"];
+				std::string_view list = GetScopeKey(2);
+				if (list == "Interactables") m_Spawn = &m_Map.interactables;
+				else if (list == "Traps") m_Spawn = &m_Map.traps;
+				else if (list == "EnemySpawns") m_Spawn = &m_Map.spawns;
+			}
 
-				SpawnData d;
-				d.x = p.value("X", 0.f);
-				d.y = p.value("Y", 0.f);
-				d.defId = p.value("DefinitionId", "");
+			if (m_Spawn)
+				m_Spawn->push_back(SchemaParser<SpawnData>::Default());
 
-				outMap.spawns.push_back(d);
+			return true;
+		}
+
+		bool OnEndObject() override
+		{
+			m_Spawn = nullptr;
+			return true;
+		}
+
+		bool OnValue(const EngineCore::JsonScalar& value) override
+		{
+			if (m_InCollision)
+			{
+				if (value.kind != EngineCore::JsonScalar::Kind::Integer || value.integer < 0 || value.integer > 255)
+					return Fail("Collision value out of range");
+
+				m_Tiles.push_back(static_cast<uint8_t>(value.integer));
+				return true;
 			}
 
-			if (j.contains("EnemySpawns"))
+			//Parsing map basics
+			if (GetDepth() == 1)
 			{
-				for (auto& i : j["EnemySpawns"])
-				{
-					SpawnData d;
-					d.x = i.value("X", 0.f);
-					d.y = i.value("Y", 0.f);
-					d.defId = i.value("DefinitionId", "");
-
-					outMap.spawns.push_back(d);
-				}
+				SchemaParser<MapData>::ReadField(m_Map, GetKey(), value, m_Arena);
+				return true;
 			}
 
+			if (m_Spawn)
+				SchemaParser<SpawnData>::ReadField(m_Spawn->back(), GetKey(), value, m_Arena);
+
 			return true;
 		}
+	private:
+		MapData& m_Map;
+		std::vector<uint8_t> m_Tiles;
+		std::vector<SpawnData> m_Player;
+		std::vector<SpawnData>* m_Spawn = nullptr;
+		bool m_InCollision = false;
+		bool m_HasCollision = false;
+		DataArena m_Arena;	//Only string_view fields allocate, the map schemas have none
 	};
 }
\ No newline at end of file
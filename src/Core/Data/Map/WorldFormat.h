@@ -0,0 +1,43 @@
+#pragma once
+#include <cstdint>
+#include "Core/Data/Map/MapFormat.h"
+
+namespace EngineData
+{
+	//.ttworld layout: header, chunk table, chunk blobs, string table
+	//A chunk blob is its square of 8-bit cells (edge chunks padded with walls) followed by
+	//its MapFileSpawn entries, enemies then interactables then traps, positions in tiles like .ttmap
+	constexpr uint32_t WORLD_MAGIC = 0x44575454;	//"TTWD"
+	constexpr uint32_t WORLD_VERSION = 1;
+	constexpr uint8_t WORLD_PAD_CELL = 2;		//TileType::Wall
+
+	struct WorldFileHeader
+	{
+		uint32_t magic;
+		uint32_t version;
+		int32_t width;					//Whole world in tiles
+		int32_t height;
+		int32_t tileSize;
+		int32_t chunkSize;				//Cells per chunk side
+		int32_t chunksX;
+		int32_t chunksY;
+		MapFileSpawn player;			//The player is not streamed
+		uint64_t chunksOffset;			//WorldFileChunk[chunksX * chunksY], row major
+		uint64_t stringsOffset;
+		uint64_t stringsSize;
+	};
+
+	struct WorldFileChunk
+	{
+		uint64_t offset;				//Blob start, spawns follow the cells at the next 4 byte boundary
+		uint32_t enemyCount;
+		uint32_t interactableCount;
+		uint32_t trapCount;
+		uint32_t reserved;
+	};
+
+	constexpr uint64_t WorldChunkSpawnsOffset(int32_t chunkSize)
+	{
+		return (uint64_t(chunkSize) * uint64_t(chunkSize) + 3) / 4 * 4;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,353 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <span>
+#include <vector>
+#include <tuple>
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+#include <type_traits>
+#include "Core/Hash.h"
+#include "Core/JsonSax.h"
+#include "Core/Data/DataArena.h"
+#include "Core/Data/DefinitionBlob.h"
+#include "Core/Data/DefinitionWriter.h"
+
+namespace EngineData
+{
+	enum class FieldRule : uint8_t
+	{
+		None,
+		Required,		//Non empty text or array
+		Positive,
+		NonNegative
+	};
+
+	struct NoDefault {};
+
+	//How one member type moves between json, the cooked blob and the struct
+	template<typename M>
+	struct FieldCodec;
+
+	template<>
+	struct FieldCodec<float>
+	{
+		using Default = float;
+		using Binary = float;
+		static constexpr bool IS_ARRAY = false;
+
+		static void Read(float& out, const EngineCore::JsonScalar& value, DataArena&) { out = value.AsFloat(out); }
+		static Binary Write(float value, DefinitionWriter&) { return value; }
+		static void Load(float& out, Binary binary, const DefinitionBlob&, DataArena&) { out = binary; }
+		static bool IsSet(float value) { return value != 0.f; }
+	};
+
+	template<>
+	struct FieldCodec<int>
+	{
+		using Default = int;
+		using Binary = int32_t;
+		static constexpr bool IS_ARRAY = false;
+
+		static void Read(int& out, const EngineCore::JsonScalar& value, DataArena&) { out = value.AsInt(out); }
+		static Binary Write(int value, DefinitionWriter&) { return value; }
+		static void Load(int& out, Binary binary, const DefinitionBlob&, DataArena&) { out = binary; }
+		static bool IsSet(int value) { return value != 0; }
+	};
+
+	template<>
+	struct FieldCodec<bool>
+	{
+		using Default = bool;
+		using Binary = uint32_t;
+		static constexpr bool IS_ARRAY = false;
+
+		static void Read(bool& out, const EngineCore::JsonScalar& value, DataArena&) { out = value.AsBool(out); }
+		static Binary Write(bool value, DefinitionWriter&) { return value ? 1 : 0; }
+		static void Load(bool& out, Binary binary, const DefinitionBlob&, DataArena&) { out = binary != 0; }
+		static bool IsSet(bool) { return true; }
+	};
+
+	template<>
+	struct FieldCodec<std::string_view>
+	{
+		using Default = std::string_view;	//Literals only, the view is kept as is
+		using Binary = BlobString;
+		static constexpr bool IS_ARRAY = false;
+
+		static void Read(std::string_view& out, const EngineCore::JsonScalar& value, DataArena& arena) { out = arena.Store(value.text); }
+		static Binary Write(std::string_view value, DefinitionWriter& writer) { return writer.AddString(value); }
+		static void Load(std::string_view& out, Binary binary, const DefinitionBlob& blob, DataArena&) { out = blob.GetString(binary); }
+		static bool IsSet(std::string_view value) { return !value.empty(); }
+	};
+
+	template<>
+	struct FieldCodec<std::string>
+	{
+		using Default = std::string_view;
+		using Binary = BlobString;
+		static constexpr bool IS_ARRAY = false;
+
+		static void Read(std::string& out, const EngineCore::JsonScalar& value, DataArena&) { out = value.text; }
+		static Binary Write(const std::string& value, DefinitionWriter& writer) { return writer.AddString(value); }
+		static void Load(std::string& out, Binary binary, const DefinitionBlob& blob, DataArena&) { out = blob.GetString(binary); }
+		static bool IsSet(const std::string& value) { return !value.empty(); }
+	};
+
+	template<>
+	struct FieldCodec<std::span<const int>>
+	{
+		using Default = NoDefault;
+		using Binary = BlobArray;
+		static constexpr bool IS_ARRAY = true;
+
+		static void ReadArray(std::span<const int>& out, std::span<const EngineCore::JsonScalar> values, DataArena& arena)
+		{
+			std::vector<int> items;
+			items.reserve(values.size());
+			for (const auto& value : values)
+				items.push_back(value.AsInt());
+
+			out = arena.StoreArray<int>(items);
+		}
+
+		static Binary Write(std::span<const int> value, DefinitionWriter& writer) { return writer.AddArray<int>(value); }
+		static void Load(std::span<const int>& out, Binary binary, const DefinitionBlob& blob, DataArena&) { out = blob.GetArray<int>(binary); }
+		static bool IsSet(std::span<const int> value) { return !value.empty(); }
+	};
+
+	template<>
+	struct FieldCodec<std::span<const std::string_view>>
+	{
+		using Default = NoDefault;
+		using Binary = BlobArray;	//BlobString[]
+		static constexpr bool IS_ARRAY = true;
+
+		static void ReadArray(std::span<const std::string_view>& out, std::span<const EngineCore::JsonScalar> values, DataArena& arena)
+		{
+			std::vector<std::string_view> items;
+			items.reserve(values.size());
+			for (const auto& value : values)
+				items.push_back(arena.Store(value.text));
+
+			out = arena.StoreArray<std::string_view>(items);
+		}
+
+		static Binary Write(std::span<const std::string_view> value, DefinitionWriter& writer)
+		{
+			std::vector<BlobString> items;
+			for (auto text : value)
+				items.push_back(writer.AddString(text));
+
+			return writer.AddArray<BlobString>(items);
+		}
+
+		//String views need real pointers, the only fixup the blob needs
+		static void Load(std::span<const std::string_view>& out, Binary binary, const DefinitionBlob& blob, DataArena& arena)
+		{
+			std::span<const BlobString> items = blob.GetArray<BlobString>(binary);
+			out = {};
+			if (items.empty())
+				return;
+
+			auto* views = static_cast<std::string_view*>(arena.Allocate(items.size() * sizeof(std::string_view), alignof(std::string_view)));
+			for (size_t i = 0; i < items.size(); i++)
+				views[i] = blob.GetString(items[i]);
+
+			out = { views, items.size() };
+		}
+
+		static bool IsSet(std::span<const std::string_view> value) { return !value.empty(); }
+	};
+
+	template<>
+	struct FieldCodec<std::vector<std::string>>
+	{
+		using Default = NoDefault;
+		using Binary = BlobArray;	//BlobString[]
+		static constexpr bool IS_ARRAY = true;
+
+		static void ReadArray(std::vector<std::string>& out, std::span<const EngineCore::JsonScalar> values, DataArena&)
+		{
+			out.clear();
+			for (const auto& value : values)
+			{
+				if (value.kind == EngineCore::JsonScalar::Kind::String)
+					out.emplace_back(value.text);
+			}
+		}
+
+		static Binary Write(const std::vector<std::string>& value, DefinitionWriter& writer)
+		{
+			std::vector<BlobString> items;
+			for (const auto& text : value)
+				items.push_back(writer.AddString(text));
+
+			return writer.AddArray<BlobString>(items);
+		}
+
+		static void Load(std::vector<std::string>& out, Binary binary, const DefinitionBlob& blob, DataArena&)
+		{
+			out.clear();
+			for (const auto& item : blob.GetArray<BlobString>(binary))
+				out.emplace_back(blob.GetString(item));
+		}
+
+		static bool IsSet(const std::vector<std::string>& value) { return !value.empty(); }
+	};
+
+	//One described member, the key hash is worked out at compile time
+	template<typename T, typename M>
+	struct Field
+	{
+		using Member = M;
+		using Codec = FieldCodec<M>;
+
+		std::string_view name;
+		uint64_t hash;
+		M T::* member;
+		typename Codec::Default defaultValue;
+		FieldRule rule;
+	};
+
+	template<typename T, typename M>
+	constexpr Field<T, M> MakeField(std::string_view name, M T::* member, typename FieldCodec<M>::Default defaultValue = {}, FieldRule rule = FieldRule::None)
+	{
+		return { name, EngineCore::HashFnv1a64(name), member, defaultValue, rule };
+	}
+
+	//Specialised next to each data struct with a constexpr FIELDS tuple of MakeField entries,
+	//cooked definition types also give their BLOB_TYPE. Field order is the binary record layout
+	template<typename T>
+	struct Schema;
+
+	template<typename T>
+	constexpr size_t SchemaRecordSize()
+	{
+		return std::apply([](const auto&... field)
+		{
+			return (size_t(0) + ... + sizeof(typename std::remove_cvref_t<decltype(field)>::Codec::Binary));
+		}, Schema<T>::FIELDS);
+	}
+
+	//Packed cooked record, every binary field is 4 byte aligned
+	template<typename T>
+	struct SchemaRecord
+	{
+		alignas(4) std::byte bytes[SchemaRecordSize<T>()];
+	};
+
+	//Parser generated from Schema<T>, the interface DataLibrary, JsonRecordReader and the cooker use
+	template<typename T>
+	class SchemaParser
+	{
+	public:
+		using Record = SchemaRecord<T>;
+
+		static T Default()
+		{
+			T value{};
+			ForEachField([&](const auto& field)
+			{
+				if constexpr (!std::is_same_v<typename std::remove_cvref_t<decltype(field)>::Codec::Default, NoDefault>)
+					value.*field.member = typename std::remove_cvref_t<decltype(field)>::Member(field.defaultValue);
+			});
+			return value;
+		}
+
+		static void ReadField(T& value, std::string_view key, const EngineCore::JsonScalar& scalar, DataArena& arena)
+		{
+			uint64_t hash = EngineCore::HashFnv1a64(key);
+			FindField(hash, key, [&](const auto& field)
+			{
+				using Codec = typename std::remove_cvref_t<decltype(field)>::Codec;
+				if constexpr (!Codec::IS_ARRAY)
+					Codec::Read(value.*field.member, scalar, arena);
+			});
+		}
+
+		static void ReadArray(T& value, std::string_view key, std::span<const EngineCore::JsonScalar> scalars, DataArena& arena)
+		{
+			uint64_t hash = EngineCore::HashFnv1a64(key);
+			FindField(hash, key, [&](const auto& field)
+			{
+				using Codec = typename std::remove_cvref_t<decltype(field)>::Codec;
+				if constexpr (Codec::IS_ARRAY)
+					Codec::ReadArray(value.*field.member, scalars, arena);
+			});
+		}
+
+		//Appends one message per broken rule, field names as they appear in json
+		static bool Validate(const T& value, std::vector<std::string>& outErrors)
+		{
+			size_t count = outErrors.size();
+			ForEachField([&](const auto& field)
+			{
+				using Member = typename std::remove_cvref_t<decltype(field)>::Member;
+				using Codec = typename std::remove_cvref_t<decltype(field)>::Codec;
+				const Member& member = value.*field.member;
+
+				if (field.rule == FieldRule::Required && !Codec::IsSet(member))
+					outErrors.push_back(std::string(field.name) + " is required");
+
+				if constexpr (std::is_arithmetic_v<Member> && !std::is_same_v<Member, bool>)
+				{
+					if (field.rule == FieldRule::Positive && !(member > 0))
+						outErrors.push_back(std::string(field.name) + " must be greater than zero");
+					else if (field.rule == FieldRule::NonNegative && member < 0)
+						outErrors.push_back(std::string(field.name) + " must not be negative");
+				}
+			});
+			return outErrors.size() == count;
+		}
+
+		//Binary
+		static constexpr DefinitionType BLOB_TYPE = Schema<T>::BLOB_TYPE;
+
+		static T FromRecord(const Record& record, const DefinitionBlob& blob, DataArena& arena)
+		{
+			T value{};
+			size_t offset = 0;
+			ForEachField([&](const auto& field)
+			{
+				using Codec = typename std::remove_cvref_t<decltype(field)>::Codec;
+				typename Codec::Binary binary;
+				std::memcpy(&binary, record.bytes + offset, sizeof(binary));
+				Codec::Load(value.*field.member, binary, blob, arena);
+				offset += sizeof(binary);
+			});
+			return value;
+		}
+
+		static Record ToRecord(const T& value, DefinitionWriter& writer)
+		{
+			Record record{};
+			size_t offset = 0;
+			ForEachField([&](const auto& field)
+			{
+				using Codec = typename std::remove_cvref_t<decltype(field)>::Codec;
+				typename Codec::Binary binary = Codec::Write(value.*field.member, writer);
+				std::memcpy(record.bytes + offset, &binary, sizeof(binary));
+				offset += sizeof(binary);
+			});
+			return record;
+		}
+	private:
+		template<typename Fn>
+		static void ForEachField(Fn&& fn)
+		{
+			std::apply([&](const auto&... field) { (fn(field), ...); }, Schema<T>::FIELDS);
+		}
+
+		//Stops at the first match, the name check only runs once the hash agrees
+		template<typename Fn>
+		static void FindField(uint64_t hash, std::string_view key, Fn&& fn)
+		{
+			std::apply([&](const auto&... field)
+			{
+				((field.hash == hash && field.name == key && (fn(field), true)) || ...);
+			}, Schema<T>::FIELDS);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+#pragma once
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+namespace EngineCore
+{
+	//Read-only bytes of a file, either a view into a mapping or an owned buffer
+	class FileData
+	{
+	public:
+		FileData() = default;
+
+		static FileData FromBuffer(std::vector<uint8_t>&& buffer)
+		{
+			auto owned = std::make_shared<std::vector<uint8_t>>(std::move(buffer));
+			return View(owned->data(), owned->size(), owned);
+		}
+
+		static FileData View(const uint8_t* data, size_t size, std::shared_ptr<const void> owner)
+		{
+			FileData view;
+			view.m_Data = data;
+			view.m_Size = size;
+			view.m_Owner = std::move(owner);
+			return view;
+		}
+
+		//Sub range that keeps the whole file alive
+		FileData Slice(size_t offset, size_t size) const
+		{
+			if (offset > m_Size || size > m_Size - offset)
+				return {};
+
+			return View(m_Data + offset, size, m_Owner);
+		}
+
+		const uint8_t* GetData() const { return m_Data; }
+		size_t GetSize() const { return m_Size; }
+		std::string_view AsString() const { return { reinterpret_cast<const char*>(m_Data), m_Size }; }
+		bool IsEmpty() const { return m_Size == 0; }
+	private:
+		std::shared_ptr<const void> m_Owner;
+		const uint8_t* m_Data = nullptr;
+		size_t m_Size = 0;
+	};
+}
\ No newline at end of file
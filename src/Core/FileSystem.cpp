@@ -0,0 +1,283 @@
+#include "Core/FileSystem.h"
+#include "Core/MappedFile.h"
+#include "Core/PakFormat.h"
+#include "Core/PathUtil.h"
+#include "Core/Hash.h"
+#include "Core/Lz4.h"
+#include "Core/Log.h"
+#include <filesystem>
+#include <fstream>
+#include <algorithm>
+#include <cstring>
+
+namespace EngineCore
+{
+	std::string FileSystem::s_AssetRoot;
+	std::shared_ptr<MappedFile> FileSystem::s_Pak;
+	int64_t FileSystem::s_PakTime = 0;
+
+	void FileSystem::Init()
+	{
+		s_AssetRoot = ToKey(GetAssetDirectory()) + "/";
+
+		std::string pakPath = (std::filesystem::path(GetExecutableDirectory()) / "Assets.ttpak").string();
+		if (!std::filesystem::exists(pakPath))
+		{
+			Log::Write(
+				LogLevel::Info,
+				LogCategory::Core,
+				"No asset pack found, reading loose files"
+			);
+			return;
+		}
+
+		Mount(pakPath);
+	}
+
+	//Reads trust the table of contents, so every entry's data and name has to lie inside the mapping
+	static bool ValidEntries(const MappedFile& pak, const PakHeader& header)
+	{
+		const uint64_t fileSize = pak.GetSize();
+		const PakEntry* entries = reinterpret_cast<const PakEntry*>(pak.GetData() + header.tocOffset);
+		const char* names = reinterpret_cast<const char*>(pak.GetData() + header.namesOffset);
+		const uint64_t namesSize = fileSize - header.namesOffset;
+
+		for (uint32_t i = 0; i < header.entryCount; i++)
+		{
+			const PakEntry& entry = entries[i];
+			if (entry.offset > fileSize || entry.storedSize > fileSize - entry.offset)
+				return false;
+
+			//Stored entries are viewed in place
+			if (!(entry.flags & PAK_ENTRY_LZ4) && entry.size > entry.storedSize)
+				return false;
+
+			if (entry.nameOffset >= namesSize ||
+				!std::memchr(names + entry.nameOffset, '\0', static_cast<size_t>(namesSize - entry.nameOffset)))
+				return false;
+
+			//FindEntry searches by hash
+			if (i > 0 && entries[i - 1].pathHash > entry.pathHash)
+				return false;
+		}
+
+		return true;
+	}
+
+	bool FileSystem::Mount(const std::string& pakPath)
+	{
+		auto pak = std::make_shared<MappedFile>();
+		if (!pak->Open(pakPath) || pak->GetSize() < sizeof(PakHeader))
+		{
+			Log::Write(
+				LogLevel::Error,
+				LogCategory::Core,
+				"Failed to map asset pack : " + pakPath
+			);
+			return false;
+		}
+
+		const PakHeader* header = reinterpret_cast<const PakHeader*>(pak->GetData());
+		if (header->magic != PAK_MAGIC || header->version != PAK_VERSION ||
+			header->tocOffset > pak->GetSize() ||
+			uint64_t(header->entryCount) * sizeof(PakEntry) > pak->GetSize() - header->tocOffset ||
+			header->namesOffset > pak->GetSize() ||
+			!ValidEntries(*pak, *header))
+		{
+			Log::Write(
+				LogLevel::Error,
+				LogCategory::Core,
+				"Invalid asset pack : " + pakPath
+			);
+			return false;
+		}
+
+		std::error_code error;
+		s_PakTime = static_cast<int64_t>(std::filesystem::last_write_time(pakPath, error).time_since_epoch().count());
+		s_Pak = std::move(pak);
+
+		Log::Write(
+			LogLevel::Info,
+			LogCategory::Core,
+			"Mounted asset pack : " + pakPath + " (" + std::to_string(header->entryCount) + " entries)"
+		);
+		return true;
+	}
+
+	void FileSystem::Shutdown()
+	{
+		//Outstanding FileData views keep the mapping alive on their own
+		s_Pak.reset();
+	}
+
+	std::string FileSystem::ToKey(const std::string& path)
+	{
+		std::string key = path;
+		std::replace(key.begin(), key.end(), '\\', '/');
+
+		if (!s_AssetRoot.empty() && key.compare(0, s_AssetRoot.size(), s_AssetRoot) == 0)
+			key.erase(0, s_AssetRoot.size());
+
+		return key;
+	}
+
+	const PakEntry* FileSystem::FindEntry(const std::string& key)
+	{
+		if (!s_Pak)
+			return nullptr;
+
+		const PakHeader* header = reinterpret_cast<const PakHeader*>(s_Pak->GetData());
+		const PakEntry* begin = reinterpret_cast<const PakEntry*>(s_Pak->GetData() + header->tocOffset);
+		const PakEntry* end = begin + header->entryCount;
+
+		uint64_t hash = HashFnv1a64(key);
+		const PakEntry* it = std::lower_bound(begin, end, hash, [](const PakEntry& entry, uint64_t value)
+		{
+			return entry.pathHash < value;
+		});
+
+		//Hash collisions are resolved by comparing the stored name
+		const char* names = reinterpret_cast<const char*>(s_Pak->GetData() + header->namesOffset);
+		for (; it != end && it->pathHash == hash; ++it)
+		{
+			if (key == names + it->nameOffset)
+				return it;
+		}
+
+		return nullptr;
+	}
+
+	bool FileSystem::Read(const std::string& path, FileData& outData)
+	{
+		if (const PakEntry* entry = FindEntry(ToKey(path)))
+		{
+			const uint8_t* stored = s_Pak->GetData() + entry->offset;
+
+			if (!(entry->flags & PAK_ENTRY_LZ4))
+			{
+				outData = FileData::View(stored, static_cast<size_t>(entry->size), s_Pak);
+				return true;
+			}
+
+			std::vector<uint8_t> buffer(static_cast<size_t>(entry->size));
+			if (!Lz4::Decompress(stored, static_cast<size_t>(entry->storedSize), buffer.data(), buffer.size()))
+			{
+				Log::Write(
+					LogLevel::Error,
+					LogCategory::Core,
+					"Corrupt pack entry : " + path
+				);
+				return false;
+			}
+
+			outData = FileData::FromBuffer(std::move(buffer));
+			return true;
+		}
+
+		//Development fallback, mapped as well so large loose files are not copied
+		auto mapped = std::make_shared<MappedFile>();
+		if (mapped->Open(path))
+		{
+			outData = FileData::View(mapped->GetData(), mapped->GetSize(), mapped);
+			return true;
+		}
+
+		//Empty files cannot be mapped
+		std::ifstream file(path, std::ios::binary | std::ios::ate);
+		if (!file.is_open())
+			return false;
+
+		std::vector<uint8_t> buffer(static_cast<size_t>(file.tellg()));
+		file.seekg(0);
+		file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+		if (!file)
+			return false;
+
+		outData = FileData::FromBuffer(std::move(buffer));
+		return true;
+	}
+
+	bool FileSystem::Exists(const std::string& path)
+	{
+		if (FindEntry(ToKey(path)))
+			return true;
+
+		std::error_code error;
+		return std::filesystem::exists(path, error);
+	}
+
+	bool FileSystem::IsPacked(const std::string& path)
+	{
+		return FindEntry(ToKey(path)) != nullptr;
+	}
+
+	bool FileSystem::GetStamp(const std::string& path, uint64_t& outSize, int64_t& outTime)
+	{
+		//Packed files share the pack's write time
+		if (const PakEntry* entry = FindEntry(ToKey(path)))
+		{
+			outSize = entry->size;
+			outTime = s_PakTime;
+			return true;
+		}
+
+		std::error_code error;
+		uintmax_t size = std::filesystem::file_size(path, error);
+		if (error)
+			return false;
+
+		auto time = std::filesystem::last_write_time(path, error);
+		if (error)
+			return false;
+
+		outSize = static_cast<uint64_t>(size);
+		outTime = static_cast<int64_t>(time.time_since_epoch().count());
+		return true;
+	}
+
+	std::vector<std::string> FileSystem::List(const std::string& directory, const std::string& extension)
+	{
+		std::vector<std::string> files;
+
+		if (s_Pak)
+		{
+			std::string prefix = ToKey(directory);
+			if (!prefix.empty() && prefix.back() != '/')
+				prefix += '/';
+
+			const PakHeader* header = reinterpret_cast<const PakHeader*>(s_Pak->GetData());
+			const PakEntry* entries = reinterpret_cast<const PakEntry*>(s_Pak->GetData() + header->tocOffset);
+			const char* names = reinterpret_cast<const char*>(s_Pak->GetData() + header->namesOffset);
+
+			for (uint32_t i = 0; i < header->entryCount; i++)
+			{
+				std::string_view name = names + entries[i].nameOffset;
+				if (name.compare(0, prefix.size(), prefix) != 0)
+					continue;
+
+				//Direct children only, same as directory_iterator
+				std::string_view file = name.substr(prefix.size());
+				if (file.find('/') != std::string_view::npos)
+					continue;
+
+				if (std::filesystem::path(file).extension() == extension)
+					files.push_back((std::filesystem::path(directory) / file).string());
+			}
+		}
+
+		std::error_code error;
+		for (auto& file : std::filesystem::directory_iterator(directory, error))
+		{
+			if (file.path().extension() != extension)
+				continue;
+
+			std::string path = file.path().string();
+			if (std::find(files.begin(), files.end(), path) == files.end())
+				files.push_back(path);
+		}
+
+		//Pak order is by hash, keep results stable for the libraries
+		std::sort(files.begin(), files.end());
+		return files;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,35 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include "Core/FileData.h"
+
+namespace EngineCore
+{
+	class MappedFile;
+	struct PakEntry;
+
+	//Assets lookup, mounted .ttpak first then loose files under Assets
+	class FileSystem
+	{
+	public:
+		static void Init();
+		static bool Mount(const std::string& pakPath);
+		static void Shutdown();
+
+		//Paths are the same ones GetFile returns
+		static bool Read(const std::string& path, FileData& outData);
+		static bool Exists(const std::string& path);
+		static bool IsPacked(const std::string& path);	//Served from the mounted pack, reads are memory copies at most
+		static bool GetStamp(const std::string& path, uint64_t& outSize, int64_t& outTime);
+		static std::vector<std::string> List(const std::string& directory, const std::string& extension);
+	private:
+		static std::string ToKey(const std::string& path);
+		static const PakEntry* FindEntry(const std::string& key);
+
+		static std::string s_AssetRoot;
+		static std::shared_ptr<MappedFile> s_Pak;
+		static int64_t s_PakTime;
+	};
+}
\ No newline at end of file
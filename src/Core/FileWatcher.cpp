@@ -0,0 +1,173 @@
+#include "Core/FileWatcher.h"
+#include <filesystem>
+#include <algorithm>
+#include <unordered_map>
+#include <chrono>
+
+#if defined(__linux__) && __has_include(<sys/inotify.h>)
+#define TT_INOTIFY 1
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+namespace EngineCore
+{
+	bool FileWatcher::s_Active = false;
+
+#ifdef TT_INOTIFY
+	//Editors save in place or write a temp file and rename it over the original
+	constexpr uint32_t WATCH_MASK = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE;
+
+	static int s_Fd = -1;
+	static std::unordered_map<int, std::filesystem::path> s_Folders;	//Watch descriptor to folder
+
+	static void WatchTree(const std::filesystem::path& root)
+	{
+		std::error_code error;
+		std::vector<std::filesystem::path> folders{ root };
+		for (auto it = std::filesystem::recursive_directory_iterator(root, error); !error && it != std::filesystem::recursive_directory_iterator(); it.increment(error))
+		{
+			if (it->is_directory(error))
+				folders.push_back(it->path());
+		}
+
+		for (const auto& folder : folders)
+		{
+			int wd = inotify_add_watch(s_Fd, folder.c_str(), WATCH_MASK);
+			if (wd >= 0)
+				s_Folders[wd] = folder;
+		}
+	}
+
+	bool FileWatcher::Init(const std::string& root)
+	{
+		Shutdown();
+
+		s_Fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		if (s_Fd < 0)
+			return false;
+
+		WatchTree(root);
+		s_Active = !s_Folders.empty();
+		if (!s_Active)
+			Shutdown();
+
+		return s_Active;
+	}
+
+	void FileWatcher::Shutdown()
+	{
+		if (s_Fd >= 0)
+			close(s_Fd);
+
+		s_Fd = -1;
+		s_Folders.clear();
+		s_Active = false;
+	}
+
+	void FileWatcher::Poll(std::vector<std::string>& outChanged)
+	{
+		if (s_Fd < 0)
+			return;
+
+		alignas(inotify_event) char buffer[16 * 1024];
+		while (true)
+		{
+			ssize_t length = read(s_Fd, buffer, sizeof(buffer));
+			if (length <= 0)
+				break;
+
+			for (char* at = buffer; at < buffer + length; at += sizeof(inotify_event) + reinterpret_cast<inotify_event*>(at)->len)
+			{
+				const inotify_event* event = reinterpret_cast<const inotify_event*>(at);
+				auto folder = s_Folders.find(event->wd);
+				if (folder == s_Folders.end() || event->len == 0)
+					continue;
+
+				std::filesystem::path path = folder->second / event->name;
+				if (event->mask & IN_ISDIR)
+				{
+					//New folders are watched too, files copied in with them are reported by the next write
+					if (event->mask & (IN_CREATE | IN_MOVED_TO))
+						WatchTree(path);
+					continue;
+				}
+
+				//Creation alone is followed by IN_CLOSE_WRITE once the file is complete
+				if (event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO))
+					outChanged.push_back(path.string());
+			}
+		}
+
+		std::sort(outChanged.begin(), outChanged.end());
+		outChanged.erase(std::unique(outChanged.begin(), outChanged.end()), outChanged.end());
+	}
+#else
+	//No change notifications here, the tree is rescanned at most twice a second
+	constexpr auto SCAN_INTERVAL = std::chrono::milliseconds(500);
+
+	static std::filesystem::path s_Root;
+	static std::unordered_map<std::string, std::filesystem::file_time_type> s_Stamps;
+	static std::chrono::steady_clock::time_point s_LastScan;
+
+	static void Scan(std::vector<std::string>* outChanged)
+	{
+		std::error_code error;
+		for (auto it = std::filesystem::recursive_directory_iterator(s_Root, error); !error && it != std::filesystem::recursive_directory_iterator(); it.increment(error))
+		{
+			if (!it->is_regular_file(error))
+				continue;
+
+			auto time = it->last_write_time(error);
+			if (error)
+				continue;
+
+			auto [stamp, added] = s_Stamps.try_emplace(it->path().string(), time);
+			if (!added && stamp->second == time)
+				continue;
+
+			stamp->second = time;
+			if (outChanged)
+				outChanged->push_back(stamp->first);
+		}
+	}
+
+	bool FileWatcher::Init(const std::string& root)
+	{
+		Shutdown();
+
+		std::error_code error;
+		if (!std::filesystem::is_directory(root, error))
+			return false;
+
+		s_Root = root;
+		Scan(nullptr);
+		s_LastScan = std::chrono::steady_clock::now();
+		s_Active = true;
+		return true;
+	}
+
+	void FileWatcher::Shutdown()
+	{
+		s_Stamps.clear();
+		s_Active = false;
+	}
+
+	void FileWatcher::Poll(std::vector<std::string>& outChanged)
+	{
+		if (!s_Active)
+			return;
+
+		auto now = std::chrono::steady_clock::now();
+		if (now - s_LastScan < SCAN_INTERVAL)
+			return;
+
+		s_LastScan = now;
+		Scan(&outChanged);
+
+		std::sort(outChanged.begin(), outChanged.end());
+		outChanged.erase(std::unique(outChanged.begin(), outChanged.end()), outChanged.end());
+	}
+#endif
+}
\ No newline at end of file
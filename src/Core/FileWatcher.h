@@ -0,0 +1,20 @@
+#pragma once
+#include <string>
+#include <vector>
+
+namespace EngineCore
+{
+	//Reports files written under a folder tree, inotify on Linux and a timestamp scan elsewhere
+	class FileWatcher
+	{
+	public:
+		static bool Init(const std::string& root);
+		static void Shutdown();
+		static bool IsActive() { return s_Active; }
+
+		//Main thread, never blocks, each changed file is reported once per call
+		static void Poll(std::vector<std::string>& outChanged);
+	private:
+		static bool s_Active;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+
+namespace EngineCore
+{
+	//FNV-1a, stable across runs and platforms so it can be written to cooked files
+	constexpr uint64_t HashFnv1a64(std::string_view text)
+	{
+		uint64_t hash = 14695981039346656037ull;
+		for (char c : text)
+		{
+			hash ^= static_cast<uint8_t>(c);
+			hash *= 1099511628211ull;
+		}
+
+		return hash;
+	}
+
+	//Runtime ids, see StringId
+	constexpr uint32_t HashFnv1a32(std::string_view text)
+	{
+		uint32_t hash = 2166136261u;
+		for (char c : text)
+		{
+			hash ^= static_cast<uint8_t>(c);
+			hash *= 16777619u;
+		}
+
+		return hash;
+	}
+
+	//Raw values, chained through hash so several fields fold into one
+	inline uint32_t HashFnv1a32(const void* data, size_t size, uint32_t hash = 2166136261u)
+	{
+		const uint8_t* bytes = static_cast<const uint8_t*>(data);
+		for (size_t i = 0; i < size; i++)
+		{
+			hash ^= bytes[i];
+			hash *= 16777619u;
+		}
+
+		return hash;
+	}
+}
\ No newline at end of file
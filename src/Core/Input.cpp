@@ -3,20 +3,21 @@
 namespace EngineCore
 {
 	bool Input::s_Quit = false;
-	std::unordered_map<KeyCode, KeyState> Input::s_KeyState;
-	std::unordered_map<MouseButton, KeyState> Input::s_MouseState;
-	int Input::s_MouseX = 0;
-	int Input::s_MouseY = 0;
+	InputState Input::s_State;
 
-	/*Lifecycle*/
-	void Input::Init()
+	/*State*/
+	InputState::InputState()
 	{
-		s_Quit = false;
-		s_KeyState.clear();
-		s_MouseState.clear();
-		s_MouseState[MouseButton::Left] = KeyState::None;
-		s_MouseState[MouseButton::Right] = KeyState::None;
-		s_MouseState[MouseButton::Middle] = KeyState::None;
+		Reset();
+	}
+
+	void InputState::Reset()
+	{
+		m_KeyState.clear();
+		m_MouseState.clear();
+		m_MouseState[MouseButton::Left] = KeyState::None;
+		m_MouseState[MouseButton::Right] = KeyState::None;
+		m_MouseState[MouseButton::Middle] = KeyState::None;
 
 		const KeyCode allKeys[] = {
 			KeyCode::W,
@@ -27,21 +28,20 @@ namespace EngineCore
 			KeyCode::Escape,
 			KeyCode::F1,
 			KeyCode::F5,
+			KeyCode::F8,
 			KeyCode::F9
 		};
 
 		for(KeyCode key : allKeys)
-			s_KeyState[key] = KeyState::None;
-	}
-
-	void Input::BeginFrame()
-	{
+			m_KeyState[key] = KeyState::None;
 
+		m_MouseX = 0;
+		m_MouseY = 0;
 	}
 
-	void Input::EndFrame()
+	void InputState::EndFrame()
 	{
-		for (auto& [key, state] : s_KeyState)
+		for (auto& [key, state] : m_KeyState)
 		{
 			if (state == KeyState::Pressed)
 				state = KeyState::Held;
@@ -49,7 +49,7 @@ namespace EngineCore
 				state = KeyState::None;
 		}
 
-		for (auto& [btn, state] : s_MouseState)
+		for (auto& [btn, state] : m_MouseState)
 		{
 			if (state == KeyState::Pressed)
 				state = KeyState::Held;
@@ -58,129 +58,93 @@ namespace EngineCore
 		}
 	}
 
-	/*SDL bridge*/
-	bool Input::IsQuit()
-	{
-		return s_Quit;
-	}
-
-	void Input::OnQuit()
+	void InputState::Set(KeyState& state, bool pressed)
 	{
-		s_Quit = true;
-	}
-
-	void Input::OnKey(int sdlKey, bool pressed)
-	{
-		KeyCode key = TranslateSdlKey(sdlKey);
-		if (key == KeyCode::Unknown)
-			return;
-
 		if (pressed)
 		{
-			if (s_KeyState[key] == KeyState::None ||
-				s_KeyState[key] == KeyState::Released)
+			if (state == KeyState::None ||
+				state == KeyState::Released)
 			{
-				s_KeyState[key] = KeyState::Pressed;
+				state = KeyState::Pressed;
 			}
 		}
 		else
 		{
-			s_KeyState[key] = KeyState::Released;
+			state = KeyState::Released;
 		}
 	}
 
-	void Input::OnMouseButton(int sdlBtn, bool pressed)
+	void InputState::SetKey(KeyCode key, bool pressed)
 	{
-		MouseButton btn;
-
-		switch (sdlBtn)
-		{
-		case SDL_BUTTON_LEFT:
-			btn = MouseButton::Left;
-			break;
-		case SDL_BUTTON_RIGHT:
-			btn = MouseButton::Right;
-			break;
-		case SDL_BUTTON_MIDDLE:
-			btn = MouseButton::Middle;
-			break;
-		default:
-			return;
-		}
-
-		if (pressed)
-		{
-			if (s_MouseState[btn] == KeyState::None ||
-				s_MouseState[btn] == KeyState::Released)
-			{
-				s_MouseState[btn] = KeyState::Pressed;
-			}
-		}
-		else
-		{
-			s_MouseState[btn] = KeyState::Released;
-		}
+		if (key != KeyCode::Unknown)
+			Set(m_KeyState[key], pressed);
 	}
 
-	void Input::OnMouseMove(int x, int y)
+	void InputState::SetKeyState(KeyCode key, KeyState state)
 	{
-		s_MouseX = x;
-		s_MouseY = y;
+		if (key != KeyCode::Unknown)
+			m_KeyState[key] = state;
 	}
 
-	/*Queries*/
-	bool Input::IsKeyDown(KeyCode key)
+	void InputState::SetMouseButton(MouseButton btn, bool pressed)
 	{
-		auto k = s_KeyState.find(key);
-		if (k == s_KeyState.end())
-			return false;
+		Set(m_MouseState[btn], pressed);
+	}
 
-		return k->second == KeyState::Pressed || k->second == KeyState::Held;
+	void InputState::SetMousePosition(int x, int y)
+	{
+		m_MouseX = x;
+		m_MouseY = y;
 	}
 
-	bool Input::IsKeyPressed(KeyCode key)
+	KeyState InputState::Get(const std::unordered_map<KeyCode, KeyState>& states, KeyCode key)
 	{
-		auto k = s_KeyState.find(key);
-		if (k == s_KeyState.end())
-			return false;
+		auto k = states.find(key);
+		return k != states.end() ? k->second : KeyState::None;
+	}
 
-		return k->second == KeyState::Pressed;
+	bool InputState::IsKeyDown(KeyCode key) const
+	{
+		KeyState state = Get(m_KeyState, key);
+		return state == KeyState::Pressed || state == KeyState::Held;
 	}
 
-	bool Input::IsKeyReleased(KeyCode key)
+	bool InputState::IsKeyPressed(KeyCode key) const
 	{
-		auto k = s_KeyState.find(key);
-		if (k == s_KeyState.end())
-			return false;
+		return Get(m_KeyState, key) == KeyState::Pressed;
+	}
 
-		return k->second == KeyState::Released;
+	bool InputState::IsKeyReleased(KeyCode key) const
+	{
+		return Get(m_KeyState, key) == KeyState::Released;
 	}
 
-	bool Input::IsMouseButtonDown(MouseButton btn)
+	bool InputState::IsMouseButtonDown(MouseButton btn) const
 	{
-		return s_MouseState[btn] == KeyState::Pressed || s_MouseState[btn] == KeyState::Held;
+		KeyState state = m_MouseState.at(btn);
+		return state == KeyState::Pressed || state == KeyState::Held;
 	}
 
-	bool Input::IsMouseButtonPressed(MouseButton btn)
+	bool InputState::IsMouseButtonPressed(MouseButton btn) const
 	{
-		return s_MouseState[btn] == KeyState::Pressed;
+		return m_MouseState.at(btn) == KeyState::Pressed;
 	}
 
-	bool Input::IsMouseButtonReleased(MouseButton btn)
+	bool InputState::IsMouseButtonReleased(MouseButton btn) const
 	{
-		return s_MouseState[btn] == KeyState::Released;
+		return m_MouseState.at(btn) == KeyState::Released;
 	}
 
-	EngineMath::Vector2 Input::GetMousePosition()
+	EngineMath::Vector2 InputState::GetMousePosition() const
 	{
 		return {
-			static_cast<float>(s_MouseX),
-			static_cast<float>(s_MouseY)
+			static_cast<float>(m_MouseX),
+			static_cast<float>(m_MouseY)
 		};
 	}
 
 	/*Axis*/
-	float Input::GetAxisHorizontal()
+	float InputState::GetAxisHorizontal() const
 	{
 		float axis = 0.0f;
 		if (IsKeyDown(KeyCode::A))
@@ -190,7 +154,7 @@ namespace EngineCore
 		return axis;
 	}
 
-	float Input::GetAxisVertical()
+	float InputState::GetAxisVertical() const
 	{
 		float axis = 0.0f;
 		if (IsKeyDown(KeyCode::W))
@@ -200,6 +164,62 @@ namespace EngineCore
 		return axis;
 	}
 
+	/*Lifecycle*/
+	void Input::Init()
+	{
+		s_Quit = false;
+		s_State.Reset();
+	}
+
+	void Input::BeginFrame()
+	{
+
+	}
+
+	void Input::EndFrame()
+	{
+		s_State.EndFrame();
+	}
+
+	/*SDL bridge*/
+	bool Input::IsQuit()
+	{
+		return s_Quit;
+	}
+
+	void Input::OnQuit()
+	{
+		s_Quit = true;
+	}
+
+	void Input::OnKey(int sdlKey, bool pressed)
+	{
+		s_State.SetKey(TranslateSdlKey(sdlKey), pressed);
+	}
+
+	void Input::OnMouseButton(int sdlBtn, bool pressed)
+	{
+		switch (sdlBtn)
+		{
+		case SDL_BUTTON_LEFT:
+			s_State.SetMouseButton(MouseButton::Left, pressed);
+			break;
+		case SDL_BUTTON_RIGHT:
+			s_State.SetMouseButton(MouseButton::Right, pressed);
+			break;
+		case SDL_BUTTON_MIDDLE:
+			s_State.SetMouseButton(MouseButton::Middle, pressed);
+			break;
+		default:
+			return;
+		}
+	}
+
+	void Input::OnMouseMove(int x, int y)
+	{
+		s_State.SetMousePosition(x, y);
+	}
+
 	//Helper method
 	KeyCode Input::TranslateSdlKey(int scancode)
 	{
@@ -221,6 +241,8 @@ namespace EngineCore
 			return KeyCode::F1;
 		case SDL_SCANCODE_F5:
 			return KeyCode::F5;
+		case SDL_SCANCODE_F8:
+			return KeyCode::F8;
 		case SDL_SCANCODE_F9:
 			return KeyCode::F9;
 		default:
@@ -17,6 +17,7 @@ namespace EngineCore
 		Escape,
 		F1,
 		F5,
+		F8,
 		F9
 	};
 
@@ -35,6 +36,40 @@ namespace EngineCore
 		Released
 	};
 
+	//Keys and mouse of one game instance, the window's lives in Input, headless games fill their own
+	class InputState
+	{
+	public:
+		InputState();
+
+		void Reset();
+		void EndFrame();	//Pressed becomes Held, Released becomes None
+
+		void SetKey(KeyCode key, bool pressed);
+		void SetKeyState(KeyCode key, KeyState state);		//Replayed frames, no transition from the last one
+		void SetMouseButton(MouseButton btn, bool pressed);
+		void SetMousePosition(int x, int y);
+
+		bool IsKeyDown(KeyCode key) const;		//Held | Pressed
+		bool IsKeyPressed(KeyCode key) const;	//First frame pressed
+		bool IsKeyReleased(KeyCode key) const;	//First frame released
+		bool IsMouseButtonDown(MouseButton btn) const;
+		bool IsMouseButtonPressed(MouseButton btn) const;
+		bool IsMouseButtonReleased(MouseButton btn) const;
+		EngineMath::Vector2 GetMousePosition() const;
+
+		float GetAxisHorizontal() const;
+		float GetAxisVertical() const;
+	private:
+		static KeyState Get(const std::unordered_map<KeyCode, KeyState>& states, KeyCode key);
+		static void Set(KeyState& state, bool pressed);
+
+		std::unordered_map<KeyCode, KeyState> m_KeyState;
+		std::unordered_map<MouseButton, KeyState> m_MouseState;
+		int m_MouseX = 0;
+		int m_MouseY = 0;
+	};
+
 	class Input
 	{
 	public:
@@ -45,17 +80,20 @@ namespace EngineCore
 		static void EndFrame();
 
 		//Queries
-		static bool IsKeyDown(KeyCode key);		//Held | Pressed
-		static bool IsKeyPressed(KeyCode key);	//First frame pressed
-		static bool IsKeyReleased(KeyCode key); //First frame released
-		static bool IsMouseButtonDown(MouseButton btn);
-		static bool IsMouseButtonPressed(MouseButton btn);
-		static bool IsMouseButtonReleased(MouseButton btn);
-		static EngineMath::Vector2 GetMousePosition();
+		static bool IsKeyDown(KeyCode key) { return s_State.IsKeyDown(key); }
+		static bool IsKeyPressed(KeyCode key) { return s_State.IsKeyPressed(key); }
+		static bool IsKeyReleased(KeyCode key) { return s_State.IsKeyReleased(key); }
+		static bool IsMouseButtonDown(MouseButton btn) { return s_State.IsMouseButtonDown(btn); }
+		static bool IsMouseButtonPressed(MouseButton btn) { return s_State.IsMouseButtonPressed(btn); }
+		static bool IsMouseButtonReleased(MouseButton btn) { return s_State.IsMouseButtonReleased(btn); }
+		static EngineMath::Vector2 GetMousePosition() { return s_State.GetMousePosition(); }
 
 		//Axis
-		static float GetAxisHorizontal();		// A/D or Left/Right
-		static float GetAxisVertical();			// W/S or Up/Down
+		static float GetAxisHorizontal() { return s_State.GetAxisHorizontal(); }		// A/D
+		static float GetAxisVertical() { return s_State.GetAxisVertical(); }			// W/S
+
+		//The window's state, what the windowed game's context reads
+		static InputState& GetState() { return s_State; }
 
 		//SDL bridge
 		static void OnKey(int sdlKey, bool pressed);
@@ -66,9 +104,6 @@ namespace EngineCore
 	private:
 		static KeyCode TranslateSdlKey(int sdlKey);
 		static bool s_Quit;
-		static std::unordered_map<KeyCode, KeyState> s_KeyState;
-		static std::unordered_map<MouseButton, KeyState> s_MouseState;
-		static int s_MouseX;
-		static int s_MouseY;
+		static InputState s_State;
 	};
 }
\ No newline at end of file
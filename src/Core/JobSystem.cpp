@@ -0,0 +1,134 @@
+#include "Core/JobSystem.h"
+#include "Core/Log.h"
+#include <atomic>
+#include <algorithm>
+#include <memory>
+
+namespace EngineCore
+{
+	std::vector<std::thread> JobSystem::s_Workers;
+	std::deque<Job> JobSystem::s_Jobs;
+	std::mutex JobSystem::s_Mutex;
+	std::condition_variable JobSystem::s_Condition;
+	bool JobSystem::s_Running = false;
+
+	void JobSystem::Init(unsigned int workerCount)
+	{
+		if (s_Running)
+			return;
+
+		if (workerCount == 0)
+		{
+			unsigned int hw = std::thread::hardware_concurrency();
+			workerCount = hw > 1 ? hw - 1 : 1;
+		}
+
+		s_Running = true;
+		for (unsigned int i = 0; i < workerCount; i++)
+			s_Workers.emplace_back(WorkerLoop);
+
+		Log::Write(
+			LogLevel::Info,
+			LogCategory::Core,
+			"Job system started with " + std::to_string(workerCount) + " workers"
+		);
+	}
+
+	void JobSystem::Shutdown()
+	{
+		{
+			std::lock_guard<std::mutex> lock(s_Mutex);
+			if (!s_Running)
+				return;
+
+			//Jobs that did not start yet are dropped
+			s_Running = false;
+			s_Jobs.clear();
+		}
+
+		s_Condition.notify_all();
+		for (auto& worker : s_Workers)
+			worker.join();
+
+		s_Workers.clear();
+	}
+
+	void JobSystem::Submit(Job job)
+	{
+		{
+			std::lock_guard<std::mutex> lock(s_Mutex);
+			if (!s_Running)
+				return;
+
+			s_Jobs.push_back(std::move(job));
+		}
+
+		s_Condition.notify_one();
+	}
+
+	void JobSystem::ParallelFor(size_t count, const std::function<void(size_t)>& body)
+	{
+		if (count == 0)
+			return;
+
+		struct Batch
+		{
+			std::atomic<size_t> next = 0;
+			std::atomic<size_t> done = 0;
+			std::mutex mutex;
+			std::condition_variable finished;
+		};
+
+		auto batch = std::make_shared<Batch>();
+
+		//Helpers that start after the batch drained only touch the shared state
+		auto work = [batch, count, &body]()
+		{
+			size_t index;
+			while ((index = batch->next.fetch_add(1)) < count)
+			{
+				body(index);
+				if (batch->done.fetch_add(1) + 1 == count)
+				{
+					std::lock_guard<std::mutex> lock(batch->mutex);
+					batch->finished.notify_all();
+				}
+			}
+		};
+
+		size_t helpers = std::min<size_t>(count - 1, s_Workers.size());
+		for (size_t i = 0; i < helpers; i++)
+			Submit(work);
+
+		//Caller takes items too, so nested calls from a worker cannot starve
+		work();
+
+		std::unique_lock<std::mutex> lock(batch->mutex);
+		batch->finished.wait(lock, [&] { return batch->done.load() == count; });
+	}
+
+	unsigned int JobSystem::GetWorkerCount()
+	{
+		return static_cast<unsigned int>(s_Workers.size());
+	}
+
+	void JobSystem::WorkerLoop()
+	{
+		while (true)
+		{
+			Job job;
+			{
+				std::unique_lock<std::mutex> lock(s_Mutex);
+				s_Condition.wait(lock, [] { return !s_Running || !s_Jobs.empty(); });
+
+				if (!s_Running)
+					return;
+
+				job = std::move(s_Jobs.front());
+				s_Jobs.pop_front();
+			}
+
+			job();
+		}
+	}
+}
\ No newline at end of file
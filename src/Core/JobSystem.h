@@ -0,0 +1,34 @@
+#pragma once
+#include <functional>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace EngineCore
+{
+	using Job = std::function<void()>;
+
+	class JobSystem
+	{
+	public:
+		//Lifecycle
+		static void Init(unsigned int workerCount = 0);	//0 = hardware threads - 1
+		static void Shutdown();
+
+		//Jobs
+		static void Submit(Job job);
+		//Runs body(0..count-1) across the workers and the caller, returns when all are done
+		static void ParallelFor(size_t count, const std::function<void(size_t)>& body);
+		static unsigned int GetWorkerCount();
+	private:
+		static void WorkerLoop();
+
+		static std::vector<std::thread> s_Workers;
+		static std::deque<Job> s_Jobs;
+		static std::mutex s_Mutex;
+		static std::condition_variable s_Condition;
+		static bool s_Running;
+	};
+}
\ No newline at end of file
@@ -1,36 +1,77 @@
 #include "Core/JsonLoader.h"
 #include <Core/Log.h>
-#include <fstream>
+#include "Core/FileSystem.h"
+#include <chrono>
 
 namespace EngineCore
 {
+	static bool ReadJsonFile(const std::string& path, FileData& outFile)
+	{
+		if (FileSystem::Read(path, outFile))
+			return true;
+
+		Log::Write(
+			LogLevel::Error,
+			LogCategory::Core,
+			"Failed to open json file :" + path
+		);
+		return false;
+	}
+
 	bool JsonLoader::LoadFromFile(const std::string& path, nlohmann::json& outJson)
 	{
-		std::ifstream file(path);
-		if (!file.is_open())
+		FileData file;
+		return ReadJsonFile(path, file) && LoadFromData(path, file, outJson);
+	}
+
+	bool JsonLoader::LoadFromData(const std::string& path, const FileData& file, nlohmann::json& outJson)
+	{
+		try
+		{
+			outJson = nlohmann::json::parse(file.GetData(), file.GetData() + file.GetSize());
+		}
+		catch (const std::exception& e)
 		{
 			Log::Write(
 				LogLevel::Error,
 				LogCategory::Core,
-				"Failed to open json file :" + path
+				"Json parse error :" + path + "\n" + e.what()
 			);
 			return false;
 		}
 
-		try
-		{
-			file >> outJson;
-		}
-		catch (const std::exception& e)
+		return true;
+	}
+
+	bool JsonLoader::Parse(const std::string& path, JsonSaxHandler& handler)
+	{
+		FileData file;
+		return ReadJsonFile(path, file) && Parse(path, file, handler);
+	}
+
+	bool JsonLoader::Parse(const std::string& path, const FileData& file, JsonSaxHandler& handler)
+	{
+		auto start = std::chrono::steady_clock::now();
+
+		if (!handler.Parse(file.AsString()))
 		{
 			Log::Write(
 				LogLevel::Error,
 				LogCategory::Core,
-				"Json parse error :" + path + "\n" + e.what()
+				"Json parse error :" + path + "\n" + handler.GetError()
 			);
 			return false;
 		}
 
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		double megabytes = file.GetSize() / (1024.0 * 1024.0);
+		int throughput = seconds > 0.0 ? (int)(megabytes / seconds) : 0;
+		Log::Write(
+			LogLevel::Info,
+			LogCategory::Core,
+			"Json parsed : " + path + " (" + std::to_string(file.GetSize() / 1024) + " KB, " + std::to_string(throughput) + " MB/s)"
+		);
+
 		return true;
 	}
 }
\ No newline at end of file
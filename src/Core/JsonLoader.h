@@ -1,6 +1,8 @@
 #pragma once
 #include <string>
 #include <json.hpp>
+#include "Core/JsonSax.h"
+#include "Core/FileData.h"
 
 namespace EngineCore
 {
@@ -8,5 +10,10 @@ namespace EngineCore
 	{
 	public:
 		static bool LoadFromFile(const std::string& path, nlohmann::json& outJson);
+		static bool LoadFromData(const std::string& path, const FileData& file, nlohmann::json& outJson);
+
+		//Streams the file through handler without building a DOM, logs throughput
+		static bool Parse(const std::string& path, JsonSaxHandler& handler);
+		static bool Parse(const std::string& path, const FileData& file, JsonSaxHandler& handler);	//Bytes already read, path is for logs
 	};
 }
\ No newline at end of file
@@ -0,0 +1,180 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <json.hpp>
+
+namespace EngineCore
+{
+	//One scalar from the event stream, text is only valid during the callback
+	struct JsonScalar
+	{
+		enum class Kind
+		{
+			Null,
+			Bool,
+			Integer,
+			Float,
+			String
+		};
+
+		Kind kind = Kind::Null;
+		bool boolean = false;
+		int64_t integer = 0;
+		double number = 0.0;
+		std::string_view text;
+
+		bool IsNumber() const { return kind == Kind::Integer || kind == Kind::Float; }
+
+		float AsFloat(float fallback = 0.f) const
+		{
+			if (kind == Kind::Integer) return static_cast<float>(integer);
+			if (kind == Kind::Float) return static_cast<float>(number);
+			return fallback;
+		}
+
+		int AsInt(int fallback = 0) const
+		{
+			if (kind == Kind::Integer) return static_cast<int>(integer);
+			if (kind == Kind::Float) return static_cast<int>(number);
+			return fallback;
+		}
+
+		bool AsBool(bool fallback = false) const
+		{
+			return kind == Kind::Bool ? boolean : fallback;
+		}
+	};
+
+	//Event driven parse without a DOM, tracks the key path and forwards scalars to OnValue
+	class JsonSaxHandler : public nlohmann::json_sax<nlohmann::json>
+	{
+	public:
+		bool Parse(std::string_view text)
+		{
+			m_Scopes.clear();
+			m_Key.clear();
+			m_Error.clear();
+			return nlohmann::json::sax_parse(text.begin(), text.end(), this) && m_Error.empty();
+		}
+
+		const std::string& GetError() const { return m_Error; }
+
+		//nlohmann::json_sax
+		bool null() override { return OnValue(JsonScalar{}); }
+		bool boolean(bool val) override
+		{
+			JsonScalar value;
+			value.kind = JsonScalar::Kind::Bool;
+			value.boolean = val;
+			return OnValue(value);
+		}
+		bool number_integer(number_integer_t val) override
+		{
+			JsonScalar value;
+			value.kind = JsonScalar::Kind::Integer;
+			value.integer = val;
+			return OnValue(value);
+		}
+		bool number_unsigned(number_unsigned_t val) override
+		{
+			JsonScalar value;
+			value.kind = JsonScalar::Kind::Integer;
+			value.integer = static_cast<int64_t>(val);
+			return OnValue(value);
+		}
+		bool number_float(number_float_t val, const string_t&) override
+		{
+			JsonScalar value;
+			value.kind = JsonScalar::Kind::Float;
+			value.number = val;
+			return OnValue(value);
+		}
+		bool string(string_t& val) override
+		{
+			JsonScalar value;
+			value.kind = JsonScalar::Kind::String;
+			value.text = val;
+			return OnValue(value);
+		}
+		bool binary(binary_t&) override { return Fail("Unexpected binary value"); }
+
+		bool key(string_t& val) override
+		{
+			m_Key = val;
+			return true;
+		}
+
+		bool start_object(std::size_t) override
+		{
+			Push(false);
+			return OnStartObject();
+		}
+		bool end_object() override
+		{
+			bool ok = OnEndObject();
+			Pop();
+			return ok;
+		}
+		bool start_array(std::size_t) override
+		{
+			Push(true);
+			return OnStartArray();
+		}
+		bool end_array() override
+		{
+			bool ok = OnEndArray();
+			Pop();
+			return ok;
+		}
+
+		bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& ex) override
+		{
+			return Fail(ex.what());
+		}
+	protected:
+		virtual bool OnValue(const JsonScalar& value) = 0;
+		virtual bool OnStartObject() { return true; }
+		virtual bool OnEndObject() { return true; }
+		virtual bool OnStartArray() { return true; }
+		virtual bool OnEndArray() { return true; }
+
+		//Depth 1 is the root container
+		size_t GetDepth() const { return m_Scopes.size(); }
+		bool IsArrayScope(size_t depth) const { return m_Scopes[depth - 1].isArray; }
+		//Key the container at depth was stored under, empty for the root and array items
+		std::string_view GetScopeKey(size_t depth) const { return m_Scopes[depth - 1].key; }
+		//Key of the value being reported, empty inside arrays
+		std::string_view GetKey() const { return m_Key; }
+
+		bool Fail(const std::string& error)
+		{
+			if (m_Error.empty())
+				m_Error = error;
+			return false;
+		}
+	private:
+		struct Scope
+		{
+			std::string key;
+			bool isArray;
+		};
+
+		void Push(bool isArray)
+		{
+			m_Scopes.push_back({ std::move(m_Key), isArray });
+			m_Key.clear();
+		}
+
+		void Pop()
+		{
+			m_Scopes.pop_back();
+			m_Key.clear();
+		}
+
+		std::vector<Scope> m_Scopes;
+		std::string m_Key;
+		std::string m_Error;
+	};
+}
\ No newline at end of file
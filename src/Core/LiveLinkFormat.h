@@ -0,0 +1,83 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace EngineCore
+{
+	//Editor to engine edits over a local TCP socket, every message is a header and its payload
+	//All values little endian, strings are a uint32 length and the bytes
+	constexpr uint16_t LIVELINK_PORT = 47017;
+	constexpr uint32_t LIVELINK_MAGIC = 0x4C4C5454;		//"TTLL"
+	constexpr uint16_t LIVELINK_VERSION = 1;
+	constexpr uint32_t LIVELINK_MAX_PAYLOAD = 16 * 1024 * 1024;
+
+	enum class LiveLinkMessage : uint16_t
+	{
+		Tiles = 1,			//mapId, count, { uint32 index, uint32 value }[count] on the collision layer
+		MoveSpawn = 2,		//mapId, uint32 LiveSpawnKind, float fromX, fromY, toX, toY in tiles
+		Definition = 3		//uint32 LiveDefinitionKind, json text of the edited records
+	};
+
+	enum class LiveSpawnKind : uint32_t
+	{
+		Player = 0,
+		Interactable = 1,
+		Trap = 2
+	};
+
+	enum class LiveDefinitionKind : uint32_t
+	{
+		Entity = 0,
+		Interactable = 1,
+		Trap = 2
+	};
+
+	struct LiveLinkHeader
+	{
+		uint32_t magic;
+		uint16_t type;
+		uint16_t version;
+		uint32_t size;		//Payload bytes after the header
+	};
+
+	static_assert(sizeof(LiveLinkHeader) == 12, "Header layout is shared with the editor");
+
+	//Bounds checked reads over one payload, any short read fails the rest of the message
+	class LiveLinkReader
+	{
+	public:
+		LiveLinkReader(const uint8_t* data, size_t size) : m_Data(data), m_Size(size) {}
+
+		template<typename T>
+		bool Read(T& out)
+		{
+			if (m_Size - m_Offset < sizeof(T))
+				return m_Ok = false;
+
+			std::memcpy(&out, m_Data + m_Offset, sizeof(T));
+			m_Offset += sizeof(T);
+			return m_Ok;
+		}
+
+		bool ReadString(std::string_view& out)
+		{
+			uint32_t length = 0;
+			if (!Read(length) || m_Size - m_Offset < length)
+				return m_Ok = false;
+
+			out = { reinterpret_cast<const char*>(m_Data + m_Offset), length };
+			m_Offset += length;
+			return m_Ok;
+		}
+
+		std::string_view Rest() const { return { reinterpret_cast<const char*>(m_Data + m_Offset), m_Size - m_Offset }; }
+		size_t Remaining() const { return m_Size - m_Offset; }
+		bool IsOk() const { return m_Ok; }
+	private:
+		const uint8_t* m_Data;
+		size_t m_Size;
+		size_t m_Offset = 0;
+		bool m_Ok = true;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,187 @@
+#include "Core/LiveLinkServer.h"
+#include "Core/Log.h"
+#include <string>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+namespace EngineCore
+{
+#ifdef _WIN32
+	using Socket = SOCKET;
+	constexpr Socket NO_SOCKET = INVALID_SOCKET;
+
+	static void CloseSocket(Socket socket) { closesocket(socket); }
+	static bool SetNonBlocking(Socket socket) { u_long mode = 1; return ioctlsocket(socket, FIONBIO, &mode) == 0; }
+	static bool WouldBlock() { return WSAGetLastError() == WSAEWOULDBLOCK; }
+#else
+	using Socket = int;
+	constexpr Socket NO_SOCKET = -1;
+
+	static void CloseSocket(Socket socket) { close(socket); }
+	static bool SetNonBlocking(Socket socket) { return fcntl(socket, F_SETFL, fcntl(socket, F_GETFL, 0) | O_NONBLOCK) == 0; }
+	static bool WouldBlock() { return errno == EAGAIN || errno == EWOULDBLOCK; }
+#endif
+
+	bool LiveLinkServer::s_Active = false;
+
+	static Socket s_Listener = NO_SOCKET;
+	static Socket s_Client = NO_SOCKET;
+	static std::vector<uint8_t> s_Received;		//Bytes of messages not complete yet
+#ifdef _WIN32
+	static bool s_WinsockStarted = false;
+#endif
+
+	bool LiveLinkServer::Start(uint16_t port)
+	{
+		Stop();
+
+#ifdef _WIN32
+		WSADATA data;
+		if (WSAStartup(MAKEWORD(2, 2), &data) != 0)
+			return false;
+		s_WinsockStarted = true;
+#endif
+
+		s_Listener = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+		if (s_Listener == NO_SOCKET)
+		{
+			Stop();
+			return false;
+		}
+
+#ifndef _WIN32
+		//A restarted game binds again while the last session's connections are still closing
+		int reuse = 1;
+		setsockopt(s_Listener, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+#endif
+
+		//Loopback only, nothing outside this machine can edit a running game
+		sockaddr_in address{};
+		address.sin_family = AF_INET;
+		address.sin_port = htons(port);
+		address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+		if (bind(s_Listener, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 ||
+			listen(s_Listener, 1) != 0 ||
+			!SetNonBlocking(s_Listener))
+		{
+			Log::Write(
+				LogLevel::Warning,
+				LogCategory::Core,
+				"Live link could not listen on port " + std::to_string(port)
+			);
+			Stop();
+			return false;
+		}
+
+		s_Active = true;
+		return true;
+	}
+
+	void LiveLinkServer::Stop()
+	{
+		if (s_Client != NO_SOCKET)
+			CloseSocket(s_Client);
+		if (s_Listener != NO_SOCKET)
+			CloseSocket(s_Listener);
+
+#ifdef _WIN32
+		if (s_WinsockStarted)
+			WSACleanup();
+		s_WinsockStarted = false;
+#endif
+
+		s_Client = NO_SOCKET;
+		s_Listener = NO_SOCKET;
+		s_Received.clear();
+		s_Active = false;
+	}
+
+	static void DropClient()
+	{
+		CloseSocket(s_Client);
+		s_Client = NO_SOCKET;
+		s_Received.clear();
+	}
+
+	void LiveLinkServer::Poll(std::vector<LiveLinkPacket>& outPackets)
+	{
+		if (!s_Active)
+			return;
+
+		//A new editor connection replaces the old one
+		Socket accepted = accept(s_Listener, nullptr, nullptr);
+		if (accepted != NO_SOCKET)
+		{
+			if (s_Client != NO_SOCKET)
+				DropClient();
+
+			if (SetNonBlocking(accepted))
+				s_Client = accepted;
+			else
+				CloseSocket(accepted);
+		}
+
+		if (s_Client == NO_SOCKET)
+			return;
+
+		char buffer[16 * 1024];
+		bool closed = false;
+		while (true)
+		{
+			int length = (int)recv(s_Client, buffer, sizeof(buffer), 0);
+			if (length > 0)
+			{
+				s_Received.insert(s_Received.end(), buffer, buffer + length);
+				continue;
+			}
+
+			//Zero is a clean close, anything but an empty socket is a lost connection
+			closed = length == 0 || !WouldBlock();
+			break;
+		}
+
+		size_t offset = 0;
+		while (s_Received.size() - offset >= sizeof(LiveLinkHeader))
+		{
+			LiveLinkHeader header;
+			std::memcpy(&header, s_Received.data() + offset, sizeof(header));
+
+			if (header.magic != LIVELINK_MAGIC || header.version != LIVELINK_VERSION || header.size > LIVELINK_MAX_PAYLOAD)
+			{
+				Log::Write(
+					LogLevel::Warning,
+					LogCategory::Core,
+					"Live link received a message it does not understand, dropping the connection"
+				);
+				DropClient();
+				return;
+			}
+
+			if (s_Received.size() - offset - sizeof(header) < header.size)
+				break;
+
+			const uint8_t* payload = s_Received.data() + offset + sizeof(header);
+			outPackets.push_back({ LiveLinkMessage(header.type), std::vector<uint8_t>(payload, payload + header.size) });
+			offset += sizeof(header) + header.size;
+		}
+
+		s_Received.erase(s_Received.begin(), s_Received.begin() + offset);
+
+		//The editor may send and hang up at once, what arrived before the close still applies
+		if (closed)
+			DropClient();
+	}
+}
\ No newline at end of file
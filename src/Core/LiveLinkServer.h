@@ -0,0 +1,27 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include "Core/LiveLinkFormat.h"
+
+namespace EngineCore
+{
+	struct LiveLinkPacket
+	{
+		LiveLinkMessage type;
+		std::vector<uint8_t> payload;
+	};
+
+	//Listens on localhost for the editor, one connection at a time, sockets never block the frame
+	class LiveLinkServer
+	{
+	public:
+		static bool Start(uint16_t port);
+		static void Stop();
+		static bool IsActive() { return s_Active; }
+
+		//Main thread, complete messages received since the last call in the order they were sent
+		static void Poll(std::vector<LiveLinkPacket>& outPackets);
+	private:
+		static bool s_Active;
+	};
+}
\ No newline at end of file
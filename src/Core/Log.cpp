@@ -3,32 +3,44 @@
 #include <chrono>
 #include <iomanip>
 #include <sstream>
+#include <ctime>
 #include <Core/PathUtil.h>
 
 namespace EngineCore
 {
 	LogLevel Log::s_MinLevel = LogLevel::Trace;
 	std::ofstream Log::s_LogFile;
+	std::mutex Log::s_Mutex;
+
+	static std::tm ToLocalTime(std::time_t t)
+	{
+		std::tm tm{};
+#ifdef _WIN32
+		localtime_s(&tm, &t);
+#else
+		localtime_r(&t, &tm);
+#endif
+		return tm;
+	}
 
 	void Log::Init()
 	{
-		std::string exeDir = GetExecutableDirectory();
-		std::string logDir = exeDir + "\\Logs";
+		std::filesystem::path logDir = std::filesystem::path(GetExecutableDirectory()) / "Logs";
 
-		std::filesystem::create_directory(logDir);
+		std::error_code error;
+		std::filesystem::create_directory(logDir, error);
 
 		auto now = std::chrono::system_clock::now();
 		auto t = std::chrono::system_clock::to_time_t(now);
 		
-		std::tm tm{};
-		localtime_s(&tm, &t);
+		std::tm tm = ToLocalTime(t);
 
 		std::ostringstream fileName;
-		fileName << logDir << "\\engine_"
+		fileName << "engine_"
 				 << std::put_time(&tm, "%Y_%m_%d")
 				 << ".log";
 
-		s_LogFile.open(fileName.str(), std::ios::app);
+		s_LogFile.open(logDir / fileName.str(), std::ios::app);
 
 		Write(LogLevel::Info, LogCategory::Core, "Engine Started");
 	}
@@ -46,8 +58,7 @@ namespace EngineCore
 		auto now = std::chrono::system_clock::now();
 		auto t = std::chrono::system_clock::to_time_t(now);
 		
-		std::tm tm{};
-		localtime_s(&tm, &t);
+		std::tm tm = ToLocalTime(t);
 
 		std::ostringstream line;
 		line	<< "[" << std::put_time(&tm, "%H:%M:%S") << "]"
@@ -55,6 +66,7 @@ namespace EngineCore
 				<< "[" << CategoryToString(category) << "] "
 				<< msg;
 
+		std::lock_guard<std::mutex> lock(s_Mutex);
 		if (s_LogFile.is_open())
 		{
 			s_LogFile << line.str() << std::endl;
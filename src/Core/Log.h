@@ -1,6 +1,7 @@
 #pragma once
 #include <string>
 #include <fstream>
+#include <mutex>
 
 namespace EngineCore 
 {
@@ -33,5 +34,6 @@ namespace EngineCore
 		static const char* CategoryToString(LogCategory category);
 		static LogLevel s_MinLevel;
 		static std::ofstream s_LogFile;
+		static std::mutex s_Mutex;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,164 @@
+#include "Core/Lz4.h"
+#include <cstring>
+
+namespace EngineCore
+{
+	constexpr size_t MIN_MATCH = 4;
+	constexpr size_t LAST_LITERALS = 5;		//Block must end with at least this many literals
+	constexpr size_t MATCH_SAFE_END = 12;	//No match may start in the last 12 bytes
+	constexpr size_t MAX_OFFSET = 65535;
+	constexpr int HASH_BITS = 12;
+
+	static uint32_t Read32(const uint8_t* p)
+	{
+		uint32_t value;
+		std::memcpy(&value, p, sizeof(value));
+		return value;
+	}
+
+	static void WriteLength(std::vector<uint8_t>& out, size_t length)
+	{
+		while (length >= 255)
+		{
+			out.push_back(255);
+			length -= 255;
+		}
+
+		out.push_back(static_cast<uint8_t>(length));
+	}
+
+	static void WriteSequence(std::vector<uint8_t>& out, const uint8_t* literals, size_t literalCount, size_t offset, size_t matchLength)
+	{
+		size_t matchCode = matchLength >= MIN_MATCH ? matchLength - MIN_MATCH : 0;
+
+		uint8_t token = static_cast<uint8_t>((literalCount >= 15 ? 15 : literalCount) << 4);
+		if (offset)
+			token |= static_cast<uint8_t>(matchCode >= 15 ? 15 : matchCode);
+
+		out.push_back(token);
+		if (literalCount >= 15)
+			WriteLength(out, literalCount - 15);
+
+		out.insert(out.end(), literals, literals + literalCount);
+
+		//Last sequence of a block carries literals only
+		if (!offset)
+			return;
+
+		out.push_back(static_cast<uint8_t>(offset & 0xFF));
+		out.push_back(static_cast<uint8_t>(offset >> 8));
+		if (matchCode >= 15)
+			WriteLength(out, matchCode - 15);
+	}
+
+	void Lz4::Compress(const uint8_t* src, size_t srcSize, std::vector<uint8_t>& outBlock)
+	{
+		outBlock.clear();
+		outBlock.reserve(srcSize + srcSize / 255 + 16);
+
+		size_t anchor = 0;
+
+		if (srcSize > MATCH_SAFE_END)
+		{
+			//Greedy single probe hash chain, positions stored +1 so 0 means empty
+			std::vector<uint32_t> table(size_t(1) << HASH_BITS, 0);
+
+			size_t matchStartLimit = srcSize - MATCH_SAFE_END;
+			size_t matchEndLimit = srcSize - LAST_LITERALS;
+			size_t pos = 0;
+
+			while (pos < matchStartLimit)
+			{
+				uint32_t sequence = Read32(src + pos);
+				uint32_t hash = (sequence * 2654435761u) >> (32 - HASH_BITS);
+				size_t candidate = table[hash];
+				table[hash] = static_cast<uint32_t>(pos + 1);
+
+				if (candidate == 0 || pos - (candidate - 1) > MAX_OFFSET || Read32(src + candidate - 1) != sequence)
+				{
+					pos++;
+					continue;
+				}
+
+				size_t ref = candidate - 1;
+				size_t length = MIN_MATCH;
+				while (pos + length < matchEndLimit && src[ref + length] == src[pos + length])
+					length++;
+
+				WriteSequence(outBlock, src + anchor, pos - anchor, pos - ref, length);
+
+				pos += length;
+				anchor = pos;
+			}
+		}
+
+		WriteSequence(outBlock, src + anchor, srcSize - anchor, 0, 0);
+	}
+
+	bool Lz4::Decompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize)
+	{
+		size_t in = 0;
+		size_t out = 0;
+
+		while (in < srcSize)
+		{
+			uint8_t token = src[in++];
+
+			size_t literalCount = token >> 4;
+			if (literalCount == 15)
+			{
+				uint8_t extra;
+				do
+				{
+					if (in >= srcSize)
+						return false;
+					extra = src[in++];
+					literalCount += extra;
+				} while (extra == 255);
+			}
+
+			if (literalCount > srcSize - in || literalCount > dstSize - out)
+				return false;
+
+			std::memcpy(dst + out, src + in, literalCount);
+			in += literalCount;
+			out += literalCount;
+
+			if (in == srcSize)
+				break;
+
+			if (srcSize - in < 2)
+				return false;
+
+			size_t offset = src[in] | (src[in + 1] << 8);
+			in += 2;
+			if (offset == 0 || offset > out)
+				return false;
+
+			size_t matchLength = token & 0x0F;
+			if (matchLength == 15)
+			{
+				uint8_t extra;
+				do
+				{
+					if (in >= srcSize)
+						return false;
+					extra = src[in++];
+					matchLength += extra;
+				} while (extra == 255);
+			}
+			matchLength += MIN_MATCH;
+
+			if (matchLength > dstSize - out)
+				return false;
+
+			//Byte copy, the match may overlap the bytes it produces
+			const uint8_t* match = dst + out - offset;
+			for (size_t i = 0; i < matchLength; i++)
+				dst[out + i] = match[i];
+			out += matchLength;
+		}
+
+		return out == dstSize;
+	}
+}
\ No newline at end of file
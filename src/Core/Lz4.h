@@ -0,0 +1,15 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace EngineCore
+{
+	//LZ4 block format, no frame header, the caller stores both sizes
+	class Lz4
+	{
+	public:
+		static void Compress(const uint8_t* src, size_t srcSize, std::vector<uint8_t>& outBlock);
+		static bool Decompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,35 @@
+#pragma once
+#include <cstdint>
+
+namespace EngineCore
+{
+	//.ttpak layout: header, entry data, sorted table of contents, name strings
+	constexpr uint32_t PAK_MAGIC = 0x4B505454;	//"TTPK"
+	constexpr uint32_t PAK_VERSION = 1;
+	constexpr uint64_t PAK_ALIGNMENT = 64;		//Every entry starts on a cache line
+
+	enum PakEntryFlags : uint32_t
+	{
+		PAK_ENTRY_LZ4 = 1 << 0
+	};
+
+	struct PakHeader
+	{
+		uint32_t magic;
+		uint32_t version;
+		uint32_t entryCount;
+		uint32_t reserved;
+		uint64_t tocOffset;		//PakEntry[entryCount], sorted by pathHash
+		uint64_t namesOffset;	//Null terminated paths relative to Assets, '/' separated
+	};
+
+	struct PakEntry
+	{
+		uint64_t pathHash;		//HashFnv1a64 of the relative path
+		uint64_t offset;
+		uint64_t storedSize;
+		uint64_t size;
+		uint32_t nameOffset;
+		uint32_t flags;
+	};
+}
\ No newline at end of file
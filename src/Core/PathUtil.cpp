@@ -1,30 +1,65 @@
 #include "Core/PathUtil.h"
 
+#ifdef _WIN32
 #define WIN32_LEAN_AND_MEAN
 #define NOMINMAX
 #include <windows.h>
+#endif
 
 #include <filesystem>
+#include <unordered_map>
+#include <shared_mutex>
+#include <mutex>
 
 namespace EngineCore
 {
-	std::string GetExecutableDirectory()
+	static std::filesystem::path ResolveExecutablePath()
 	{
-		char buffer[MAX_PATH];
-		GetModuleFileNameA(nullptr, buffer, MAX_PATH);
+#ifdef _WIN32
+		wchar_t buffer[MAX_PATH];
+		DWORD length = GetModuleFileNameW(nullptr, buffer, MAX_PATH);
+		return std::filesystem::path(std::wstring(buffer, length));
+#else
+		std::error_code error;
+		std::filesystem::path path = std::filesystem::read_symlink("/proc/self/exe", error);
+		if (error)
+			return std::filesystem::current_path() / "TTEngine";
+		return path;
+#endif
+	}
 
-		std::string fullPath(buffer);
-		size_t lastSlash = fullPath.find_last_of("\\/");
-		return fullPath.substr(0, lastSlash);
+	const std::string& GetExecutableDirectory()
+	{
+		static const std::string directory = ResolveExecutablePath().parent_path().string();
+		return directory;
 	}
 
-	std::string GetFile(std::string folderName, std::string fileName)
+	const std::string& GetAssetDirectory()
 	{
-		std::string rootDir = GetExecutableDirectory() + "\\Assets";
-		std::filesystem::path asset = std::filesystem::path(rootDir);
+		static const std::string directory = (std::filesystem::path(GetExecutableDirectory()) / "Assets").string();
+		return directory;
+	}
+
+	//Values never move once inserted, so returned references stay valid
+	static std::unordered_map<std::string, std::string> s_Files;
+	static std::shared_mutex s_FilesMutex;
+
+	const std::string& GetFile(std::string_view folderName, std::string_view fileName)
+	{
+		std::string key;
+		key.reserve(folderName.size() + fileName.size() + 1);
+		key.append(folderName).append(1, '|').append(fileName);
+
+		{
+			std::shared_lock<std::shared_mutex> lock(s_FilesMutex);
+			auto it = s_Files.find(key);
+			if (it != s_Files.end())
+				return it->second;
+		}
 
-		std::string targetPath = (asset / folderName / fileName).string();
+		std::string targetPath = (std::filesystem::path(GetAssetDirectory()) / folderName / fileName).string();
 
-		return targetPath;
+		std::unique_lock<std::shared_mutex> lock(s_FilesMutex);
+		return s_Files.try_emplace(std::move(key), std::move(targetPath)).first->second;
 	}
 }
\ No newline at end of file
@@ -1,8 +1,13 @@
 #pragma once
 #include <string>
+#include <string_view>
 
 namespace EngineCore
 {
-	std::string GetExecutableDirectory();
-	std::string GetFile(std::string folderName, std::string fileName);
+	//Resolved once, safe to call from any thread
+	const std::string& GetExecutableDirectory();
+	const std::string& GetAssetDirectory();
+
+	//Interned, repeated lookups return the same string without touching the file system
+	const std::string& GetFile(std::string_view folderName, std::string_view fileName);
 }
\ No newline at end of file
@@ -0,0 +1,183 @@
+#include "Core/StartupGraph.h"
+#include "Core/JobSystem.h"
+#include "Core/Log.h"
+#include <SDL3/SDL.h>
+#include <unordered_map>
+#include <algorithm>
+
+namespace EngineCore
+{
+	void StartupGraph::Add(const std::string& name, StageThread thread, std::function<void()> run, const std::vector<std::string>& after)
+	{
+		Stage& stage = m_Stages.emplace_back();
+		stage.name = name;
+		stage.thread = thread;
+		stage.run = std::move(run);
+		stage.after = after;
+	}
+
+	bool StartupGraph::Run()
+	{
+		if (!Resolve())
+			return false;
+
+		m_Start = SDL_GetPerformanceCounter();
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			for (size_t i = 0; i < m_Stages.size(); i++)
+			{
+				if (m_Stages[i].waiting == 0)
+					Dispatch(i);
+			}
+		}
+
+		//Main thread stages run here, worker stages finish on their own and wake this loop
+		while (true)
+		{
+			size_t index;
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				m_Changed.wait(lock, [this]() { return !m_MainReady.empty() || m_Finished == m_Stages.size(); });
+				if (m_MainReady.empty())
+					break;
+
+				index = m_MainReady.front();
+				m_MainReady.pop_front();
+			}
+
+			Execute(index);
+		}
+
+		LogBreakdown();
+		return true;
+	}
+
+	bool StartupGraph::Resolve()
+	{
+		std::unordered_map<std::string, size_t> lookup;
+		for (size_t i = 0; i < m_Stages.size(); i++)
+			lookup.emplace(m_Stages[i].name, i);
+
+		for (size_t i = 0; i < m_Stages.size(); i++)
+		{
+			for (const auto& name : m_Stages[i].after)
+			{
+				auto it = lookup.find(name);
+				if (it == lookup.end())
+				{
+					Log::Write(
+						LogLevel::Fatal,
+						LogCategory::Core,
+						"Startup stage " + m_Stages[i].name + " waits for unknown stage " + name
+					);
+					return false;
+				}
+
+				m_Stages[it->second].dependents.push_back(i);
+				m_Stages[i].waiting++;
+			}
+		}
+
+		//Every stage has to be reachable from the ones without dependencies
+		std::vector<size_t> waiting(m_Stages.size());
+		std::vector<size_t> open;
+		for (size_t i = 0; i < m_Stages.size(); i++)
+		{
+			waiting[i] = m_Stages[i].waiting;
+			if (waiting[i] == 0)
+				open.push_back(i);
+		}
+
+		size_t visited = 0;
+		while (!open.empty())
+		{
+			size_t index = open.back();
+			open.pop_back();
+			visited++;
+
+			for (size_t dependent : m_Stages[index].dependents)
+			{
+				if (--waiting[dependent] == 0)
+					open.push_back(dependent);
+			}
+		}
+
+		if (visited != m_Stages.size())
+		{
+			Log::Write(
+				LogLevel::Fatal,
+				LogCategory::Core,
+				"Startup stages have a dependency cycle"
+			);
+			return false;
+		}
+
+		return true;
+	}
+
+	void StartupGraph::Dispatch(size_t index)
+	{
+		if (m_Stages[index].thread == StageThread::Worker && JobSystem::GetWorkerCount() > 0)
+		{
+			JobSystem::Submit([this, index]() { Execute(index); });
+			return;
+		}
+
+		m_MainReady.push_back(index);
+		m_Changed.notify_all();
+	}
+
+	void StartupGraph::Execute(size_t index)
+	{
+		Stage& stage = m_Stages[index];
+
+		uint64_t start = SDL_GetPerformanceCounter();
+		stage.run();
+		uint64_t end = SDL_GetPerformanceCounter();
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		stage.startMs = GetMs(start);
+		stage.durationMs = GetMs(end) - stage.startMs;
+		m_Finished++;
+
+		for (size_t dependent : stage.dependents)
+		{
+			if (--m_Stages[dependent].waiting == 0)
+				Dispatch(dependent);
+		}
+
+		m_Changed.notify_all();
+	}
+
+	double StartupGraph::GetMs(uint64_t counter) const
+	{
+		return (counter - m_Start) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+	}
+
+	void StartupGraph::LogBreakdown() const
+	{
+		std::vector<const Stage*> order;
+		for (const auto& stage : m_Stages)
+			order.push_back(&stage);
+
+		std::sort(order.begin(), order.end(), [](const Stage* a, const Stage* b) { return a->startMs < b->startMs; });
+
+		double totalMs = 0.0;
+		for (const Stage* stage : order)
+		{
+			totalMs = std::max(totalMs, stage->startMs + stage->durationMs);
+			Log::Write(
+				LogLevel::Info,
+				LogCategory::Core,
+				"Startup " + stage->name + (stage->thread == StageThread::Main ? " (main)" : " (worker)") +
+				" started at " + std::to_string(stage->startMs) + " ms, took " + std::to_string(stage->durationMs) + " ms"
+			);
+		}
+
+		Log::Write(
+			LogLevel::Info,
+			LogCategory::Core,
+			"Startup stages finished in " + std::to_string(totalMs) + " ms"
+		);
+	}
+}
\ No newline at end of file
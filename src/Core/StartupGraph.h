@@ -0,0 +1,54 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
+
+namespace EngineCore
+{
+	enum class StageThread
+	{
+		Main,		//SDL video, renderer and anything touching them
+		Worker		//Job system, file reads and parsing
+	};
+
+	//Startup work as named stages with dependencies, each stage starts as soon as the ones it needs are done
+	class StartupGraph
+	{
+	public:
+		void Add(const std::string& name, StageThread thread, std::function<void()> run, const std::vector<std::string>& after = {});
+
+		//Main thread, returns once every stage has run and logs the per stage breakdown
+		bool Run();
+	private:
+		struct Stage
+		{
+			std::string name;
+			StageThread thread;
+			std::function<void()> run;
+			std::vector<std::string> after;
+
+			std::vector<size_t> dependents;
+			size_t waiting = 0;		//Unfinished dependencies
+			double startMs = 0.0;
+			double durationMs = 0.0;
+		};
+
+		bool Resolve();
+		void Dispatch(size_t index);	//Lock held
+		void Execute(size_t index);
+		double GetMs(uint64_t counter) const;
+		void LogBreakdown() const;
+
+		std::vector<Stage> m_Stages;
+		std::deque<size_t> m_MainReady;
+		size_t m_Finished = 0;
+		uint64_t m_Start = 0;
+
+		std::mutex m_Mutex;
+		std::condition_variable m_Changed;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+#include "Core/StringId.h"
+#include "Core/Log.h"
+#include <string>
+#include <unordered_map>
+#include <shared_mutex>
+#include <mutex>
+
+namespace EngineCore
+{
+	//Node based, the text never moves once inserted
+	static std::unordered_map<uint32_t, std::string> s_Texts;
+	static std::shared_mutex s_TextsMutex;
+
+	StringId StringTable::Intern(std::string_view text)
+	{
+		StringId id(text);
+
+		{
+			std::shared_lock<std::shared_mutex> lock(s_TextsMutex);
+			auto it = s_Texts.find(id.value);
+			if (it != s_Texts.end())
+			{
+				if (it->second != text)
+				{
+					Log::Write(
+						LogLevel::Error,
+						LogCategory::Core,
+						"String id collision : '" + it->second + "' and '" + std::string(text) + "'"
+					);
+				}
+				return id;
+			}
+		}
+
+		std::unique_lock<std::shared_mutex> lock(s_TextsMutex);
+		s_Texts.try_emplace(id.value, text);
+		return id;
+	}
+
+	std::string_view StringTable::GetText(StringId id)
+	{
+		std::shared_lock<std::shared_mutex> lock(s_TextsMutex);
+		auto it = s_Texts.find(id.value);
+		return it != s_Texts.end() ? std::string_view(it->second) : std::string_view();
+	}
+}
\ No newline at end of file
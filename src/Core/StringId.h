@@ -0,0 +1,27 @@
+#pragma once
+#include <string_view>
+#include <cstdint>
+#include "Core/Hash.h"
+
+namespace EngineCore
+{
+	//32 bit FNV-1a of the text, literals hash at compile time
+	struct StringId
+	{
+		uint32_t value = 0;
+
+		constexpr StringId() = default;
+		constexpr explicit StringId(std::string_view text) : value(HashFnv1a32(text)) {}
+
+		constexpr bool IsValid() const { return value != 0; }
+		constexpr bool operator==(const StringId&) const = default;
+	};
+
+	//Remembers the text behind every id made at load time, two texts sharing a hash are logged
+	class StringTable
+	{
+	public:
+		static StringId Intern(std::string_view text);
+		static std::string_view GetText(StringId id);	//Empty for ids never interned
+	};
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+#include "Core/UdpSocket.h"
+#include "Core/Log.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+namespace EngineCore
+{
+#ifdef _WIN32
+	using Socket = SOCKET;
+
+	static void CloseSocket(Socket socket) { closesocket(socket); }
+	static bool SetNonBlocking(Socket socket) { u_long mode = 1; return ioctlsocket(socket, FIONBIO, &mode) == 0; }
+	//A datagram that reached a closed port comes back as an error on the next read, the peer may just not be up yet
+	static bool ConnectionReset() { return WSAGetLastError() == WSAECONNRESET; }
+#else
+	using Socket = int;
+
+	static void CloseSocket(Socket socket) { close(socket); }
+	static bool SetNonBlocking(Socket socket) { return fcntl(socket, F_SETFL, fcntl(socket, F_GETFL, 0) | O_NONBLOCK) == 0; }
+	static bool ConnectionReset() { return false; }
+#endif
+
+	bool UdpSocket::Open(uint16_t localPort, const std::string& peerHost, uint16_t peerPort)
+	{
+		Close();
+
+		in_addr peer{};
+		if (inet_pton(AF_INET, peerHost.c_str(), &peer) != 1)
+		{
+			Log::Write(
+				LogLevel::Error,
+				LogCategory::Core,
+				"Not an IPv4 address : " + peerHost
+			);
+			return false;
+		}
+
+#ifdef _WIN32
+		WSADATA data;
+		if (WSAStartup(MAKEWORD(2, 2), &data) != 0)
+			return false;
+		m_WinsockStarted = true;
+#endif
+
+		Socket socketHandle = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+		m_Socket = (intptr_t)socketHandle;
+		if (!IsOpen())
+		{
+			Close();
+			return false;
+		}
+
+		//Same machine sessions stay off the network
+		bool loopback = (ntohl(peer.s_addr) >> 24) == 127;
+
+		sockaddr_in address{};
+		address.sin_family = AF_INET;
+		address.sin_port = htons(localPort);
+		address.sin_addr.s_addr = htonl(loopback ? INADDR_LOOPBACK : INADDR_ANY);
+
+		if (bind(socketHandle, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 ||
+			!SetNonBlocking(socketHandle))
+		{
+			Log::Write(
+				LogLevel::Error,
+				LogCategory::Core,
+				"UDP socket could not bind port " + std::to_string(localPort)
+			);
+			Close();
+			return false;
+		}
+
+		m_PeerAddress = peer.s_addr;
+		m_PeerPort = htons(peerPort);
+		return true;
+	}
+
+	void UdpSocket::Close()
+	{
+		if (IsOpen())
+			CloseSocket((Socket)m_Socket);
+		m_Socket = NO_SOCKET;
+
+#ifdef _WIN32
+		if (m_WinsockStarted)
+			WSACleanup();
+#endif
+		m_WinsockStarted = false;
+	}
+
+	bool UdpSocket::Send(const void* data, size_t size)
+	{
+		if (!IsOpen())
+			return false;
+
+		sockaddr_in peer{};
+		peer.sin_family = AF_INET;
+		peer.sin_port = m_PeerPort;
+		peer.sin_addr.s_addr = m_PeerAddress;
+
+		//A full send buffer loses the datagram like the network would, the next one carries the same inputs
+		int sent = (int)sendto((Socket)m_Socket, static_cast<const char*>(data), (int)size, 0, reinterpret_cast<const sockaddr*>(&peer), sizeof(peer));
+		return sent == (int)size;
+	}
+
+	size_t UdpSocket::Receive(void* buffer, size_t capacity)
+	{
+		if (!IsOpen())
+			return 0;
+
+		while (true)
+		{
+			sockaddr_in from{};
+			socklen_t fromSize = sizeof(from);
+			int length = (int)recvfrom((Socket)m_Socket, static_cast<char*>(buffer), (int)capacity, 0, reinterpret_cast<sockaddr*>(&from), &fromSize);
+			if (length < 0)
+			{
+				if (ConnectionReset())
+					continue;
+				return 0;
+			}
+
+			if (from.sin_addr.s_addr == m_PeerAddress && from.sin_port == m_PeerPort && length > 0)
+				return (size_t)length;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,35 @@
+#pragma once
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+namespace EngineCore
+{
+	//Datagrams to and from one peer, never blocks, anything sent from another address is dropped
+	class UdpSocket
+	{
+	public:
+		UdpSocket() = default;
+		~UdpSocket() { Close(); }
+
+		UdpSocket(const UdpSocket&) = delete;
+		UdpSocket& operator=(const UdpSocket&) = delete;
+
+		//Peer is an IPv4 address, a loopback peer only binds on loopback
+		bool Open(uint16_t localPort, const std::string& peerHost, uint16_t peerPort);
+		void Close();
+		bool IsOpen() const { return m_Socket != NO_SOCKET; }
+
+		bool Send(const void* data, size_t size);
+
+		//Size of the next datagram from the peer, 0 when nothing is waiting
+		size_t Receive(void* buffer, size_t capacity);
+	private:
+		static constexpr intptr_t NO_SOCKET = -1;
+
+		intptr_t m_Socket = NO_SOCKET;		//SOCKET or file descriptor
+		uint32_t m_PeerAddress = 0;			//Network byte order
+		uint16_t m_PeerPort = 0;
+		bool m_WinsockStarted = false;
+	};
+}
\ No newline at end of file
@@ -8,19 +8,43 @@ namespace EngineGame
 	class Animator
 	{
 	public:
-		static EngineCore::Animation Create(const std::string& id)
+		//Frames go where allocator points, level objects pass their arena
+		static EngineCore::Animation Create(std::string_view id, const EngineCore::Animation::allocator_type& allocator = {})
 		{
-			EngineCore::Animation anim;
+			return Build(EnginePlatform::AnimationLibrary::Get(id), allocator);
+		}
+
+		//Hot reload, rebuilds from the definition now in the library and keeps the playback position
+		static void Refresh(EngineCore::Animation& anim, std::string_view id)
+		{
+			Replace(anim, EnginePlatform::AnimationLibrary::Get(id));
+		}
+
+		static void Refresh(EngineCore::Animation& anim)
+		{
+			if (anim.GetSource().IsValid())
+				Replace(anim, EnginePlatform::AnimationLibrary::Get(anim.GetSource()));
+		}
+	private:
+		static void Replace(EngineCore::Animation& anim, const EngineData::AnimationData* data)
+		{
+			EngineCore::Animation rebuilt = Build(data, anim.GetAllocator());
+			rebuilt.CopyPlayback(anim);
+			anim = std::move(rebuilt);
+		}
 
-			const EngineData::AnimationData* data = EnginePlatform::AnimationLibrary::Get(id);
+		static EngineCore::Animation Build(const EngineData::AnimationData* data, const EngineCore::Animation::allocator_type& allocator)
+		{
+			EngineCore::Animation anim(allocator);
 			if (!data)
 				return anim;
 
+			anim.SetSource(data->key);
 			anim.SetLoop(data->loop);
 			anim.SetFrameTime(data->frameTime);
 
-			Texture2D* tex = EnginePlatform::AssetManager::GetTexture(data->spritePath);
-			anim.SetTexture(tex);
+			//Resolved once here, render only indexes the handle
+			anim.SetTexture(EnginePlatform::AssetManager::AcquireTexture(std::string(data->spritePath)));
 
 			for (int i = 0; i < data->frameCount; i++)
 			{
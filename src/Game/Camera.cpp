@@ -21,6 +21,24 @@ namespace EngineGame
 		ApplyWorldBounds();
 	}
 
+	void Camera2D::SaveState(CameraSnapshot& out) const
+	{
+		out.x = m_X;
+		out.y = m_Y;
+		out.shakeTimer = m_ShakeTimer;
+		out.shakeDuration = m_ShakeDuration;
+		out.shakeStrength = m_ShakeStrength;
+	}
+
+	void Camera2D::LoadState(const CameraSnapshot& state)
+	{
+		m_X = state.x;
+		m_Y = state.y;
+		m_ShakeTimer = state.shakeTimer;
+		m_ShakeDuration = state.shakeDuration;
+		m_ShakeStrength = state.shakeStrength;
+	}
+
 	void Camera2D::SetSmoothness(float value)
 	{
 		m_Smoothness = value;
@@ -1,4 +1,5 @@
 #pragma once
+#include "Game/Snapshot.h"
 
 namespace EngineGame
 {
@@ -20,6 +21,9 @@ namespace EngineGame
 
 		void StartShake(float duration, float strength);
 		void UpdateShake(float dt);
+
+		void SaveState(CameraSnapshot& out) const;
+		void LoadState(const CameraSnapshot& state);
 	private:
 		void ApplyWorldBounds();
 
@@ -3,7 +3,8 @@
 
 namespace EngineGame
 {
-	Enemy::Enemy()
+	Enemy::Enemy(const allocator_type& allocator)
+		: Entity(allocator), m_AttackAnim(allocator)
 	{
 		m_Position = { 0.0f, 0.0f };
 		m_Speed = 100.0f;
@@ -15,6 +16,7 @@ namespace EngineGame
 	void Enemy::ApplyDefinition(const EngineData::EntityData& def)
 	{
 		//Base settings
+		m_Definition = def.key;
 		m_Speed = def.speed;
 		m_AttackDamage = def.attackDamage;
 		m_AttackInterval = def.attackInterval;
@@ -22,15 +24,58 @@ namespace EngineGame
 		m_HP = m_MaxHP;
 
 		//Animations
-		m_IdleAnim = Animator::Create(def.idleAnim);
-		m_WalkAnim = Animator::Create(def.walkAnim);
-		m_HurtAnim = Animator::Create(def.hurtAnim);
-		m_DeathAnim = Animator::Create(def.deathAnim);
-		m_AttackAnim = Animator::Create(def.attackAnims[0]);
+		m_IdleAnim = Animator::Create(def.idleAnim, m_Allocator);
+		m_WalkAnim = Animator::Create(def.walkAnim, m_Allocator);
+		m_HurtAnim = Animator::Create(def.hurtAnim, m_Allocator);
+		m_DeathAnim = Animator::Create(def.deathAnim, m_Allocator);
+		m_AttackAnim = Animator::Create(def.attackAnims[0], m_Allocator);
 	
 		m_CurrentAnim = &m_IdleAnim;
 	}
 
+	void Enemy::SaveState(EnemySnapshot& out) const
+	{
+		Entity::SaveState(out.entity);
+		out.state = (uint8_t)m_State;
+		out.canDealDamage = m_CanDealDamage;
+		out.stateTimer = m_StateTimer;
+		out.direction = m_Direction;
+		out.attackWindUpTimer = m_AttackWindUpTimer;
+		out.knockbackVel = m_KnockbackVel;
+		out.knockbackTimer = m_KnockbackTimer;
+	}
+
+	void Enemy::LoadState(const EnemySnapshot& state)
+	{
+		Entity::LoadState(state.entity);
+		m_State = (EnemyState)state.state;
+		m_CanDealDamage = state.canDealDamage;
+		m_StateTimer = state.stateTimer;
+		m_Direction = state.direction;
+		m_AttackWindUpTimer = state.attackWindUpTimer;
+		m_KnockbackVel = state.knockbackVel;
+		m_KnockbackTimer = state.knockbackTimer;
+	}
+
+	const EngineCore::Animation* Enemy::GetAnimationSlot(int slot) const
+	{
+		return slot == 4 ? &m_AttackAnim : Entity::GetAnimationSlot(slot);
+	}
+
+	void Enemy::ReloadDefinition(const EngineData::EntityData& def)
+	{
+		Entity::ReloadDefinition(def);
+		if (!def.attackAnims.empty())
+			Animator::Refresh(m_AttackAnim, def.attackAnims[0]);
+	}
+
+	void Enemy::RefreshAnimations(std::span<const EngineCore::StringId> changed)
+	{
+		Entity::RefreshAnimations(changed);
+		if (Contains(changed, m_AttackAnim.GetSource()))
+			Animator::Refresh(m_AttackAnim);
+	}
+
 	void Enemy::Update(float dt, const EngineMath::Vector2& playerPos, const EngineCore::AABB& playerColldier)
 	{
 		if (m_AttackCooldown > 0.0f)
@@ -271,7 +316,7 @@ namespace EngineGame
 		};
 		EngineCore::SpriteFlip flip = m_FacingRight ? EngineCore::SpriteFlip::None : EngineCore::SpriteFlip::Horizontal;
 
-		Texture2D* currentTexture = m_CurrentAnim->GetTexture();
+		Texture2D* currentTexture = EnginePlatform::AssetManager::GetTexture(m_CurrentAnim->GetTexture());
 
 		renderer->DrawTexture(
 			currentTexture,
@@ -16,19 +16,24 @@ namespace EngineGame
 	class Enemy : public Entity
 	{
 	public:
-		Enemy();
+		explicit Enemy(const allocator_type& allocator = {});	//Levels build enemies in their arena
 
 		//Base class methods
 		void Render(EngineCore::IRenderer* renderer,
 			const Camera2D& camera) override;
 		void TakeDamage(float amount, float objectDir) override;
 		void ApplyDefinition(const EngineData::EntityData& def) override;
+		void ReloadDefinition(const EngineData::EntityData& def) override;
+		void RefreshAnimations(std::span<const EngineCore::StringId> changed) override;
 
 		//Enemy Spesific Methods
 		void Update(float dt, const EngineMath::Vector2& playerPos, const EngineCore::AABB& playerCollider);
 		bool CanAttack(const EngineMath::Vector2& playerPos, 
 					   const EngineCore::AABB& playerCollider) const;
 		bool CanDealDamage() const { return m_CanDealDamage; }
+
+		void SaveState(EnemySnapshot& out) const;
+		void LoadState(const EnemySnapshot& state);
 	
 		//Debug Helper
 		std::string GetStateName() const;
@@ -39,6 +44,7 @@ namespace EngineGame
 		void UpdateDeath(float dt) override;
 		void UpdateAttack(float dt) override;
 		void UpdatePhysics(float dt) override;
+		const EngineCore::Animation* GetAnimationSlot(int slot) const override;
 
 	private:
 		//Enemy Spesific Methods
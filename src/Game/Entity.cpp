@@ -1,14 +1,124 @@
 #include "Game/Entity.h"
+#include "Game/Animator.h"
 #include "Core/Log.h"
+#include <algorithm>
 
 namespace EngineGame
 {
-	Entity::Entity()
+	Entity::Entity(const allocator_type& allocator)
+		: m_Allocator(allocator), m_IdleAnim(allocator), m_WalkAnim(allocator), m_HurtAnim(allocator), m_DeathAnim(allocator)
 	{
 		m_Position = { 0.0f, 0.0f };
 		m_Speed = 0.0f;
 	}
 
+	void Entity::ReloadDefinition(const EngineData::EntityData& def)
+	{
+		m_Speed = def.speed;
+		m_AttackDamage = def.attackDamage;
+		m_AttackInterval = def.attackInterval;
+		m_MaxHP = def.maxHp;
+		m_HP = (std::min)(m_HP, m_MaxHP);
+
+		//Animation ids may have changed too, m_CurrentAnim keeps pointing at the same member
+		Animator::Refresh(m_IdleAnim, def.idleAnim);
+		Animator::Refresh(m_WalkAnim, def.walkAnim);
+		Animator::Refresh(m_HurtAnim, def.hurtAnim);
+		Animator::Refresh(m_DeathAnim, def.deathAnim);
+	}
+
+	void Entity::RefreshAnimations(std::span<const EngineCore::StringId> changed)
+	{
+		for (EngineCore::Animation* anim : { &m_IdleAnim, &m_WalkAnim, &m_HurtAnim, &m_DeathAnim })
+		{
+			if (Contains(changed, anim->GetSource()))
+				Animator::Refresh(*anim);
+		}
+	}
+
+	void Entity::SaveState(EntitySnapshot& out) const
+	{
+		out.position = m_Position;
+		out.velocity = m_Velocity;
+		out.collider = m_Collider;
+		out.hp = m_HP;
+		out.hurtTimer = m_HurtTimer;
+		out.attackCooldown = m_AttackCooldown;
+		out.damageFlashTimer = m_DamageFlashTimer;
+
+		out.facingRight = m_FacingRight;
+		out.isDead = m_IsDead;
+		out.isMoving = m_IsMoving;
+		out.isAttacking = m_IsAttacking;
+		out.hasHitThisAttack = m_HasHitThisAttack;
+		out.isGrounded = m_IsGrounded;
+		out.colliderEnabled = m_ColliderEnabled;
+
+		out.currentAnim = -1;
+		out.animationCount = 0;
+		for (int slot = 0; slot < EntitySnapshot::MAX_ANIMATIONS; slot++)
+		{
+			const EngineCore::Animation* anim = GetAnimationSlot(slot);
+			if (!anim)
+				break;
+
+			if (anim == m_CurrentAnim)
+				out.currentAnim = (int8_t)slot;
+
+			out.animations[slot] = anim->GetPlayback();
+			out.animationCount++;
+		}
+	}
+
+	void Entity::LoadState(const EntitySnapshot& state)
+	{
+		m_Position = state.position;
+		m_Velocity = state.velocity;
+		m_Collider = state.collider;
+		m_HP = (std::min)(state.hp, m_MaxHP);
+		m_HurtTimer = state.hurtTimer;
+		m_AttackCooldown = state.attackCooldown;
+		m_DamageFlashTimer = state.damageFlashTimer;
+
+		m_FacingRight = state.facingRight;
+		m_IsDead = state.isDead;
+		m_IsMoving = state.isMoving;
+		m_IsAttacking = state.isAttacking;
+		m_HasHitThisAttack = state.hasHitThisAttack;
+		m_IsGrounded = state.isGrounded;
+		m_ColliderEnabled = state.colliderEnabled;
+
+		//Slots that no longer exist (a hot reload shortened the combo) fall back to idle
+		m_CurrentAnim = &m_IdleAnim;
+		for (int slot = 0; slot < state.animationCount; slot++)
+		{
+			auto* anim = const_cast<EngineCore::Animation*>(GetAnimationSlot(slot));
+			if (!anim)
+				break;
+
+			anim->SetPlayback(state.animations[slot]);
+			if (slot == state.currentAnim)
+				m_CurrentAnim = anim;
+		}
+	}
+
+	const EngineCore::Animation* Entity::GetAnimationSlot(int slot) const
+	{
+		switch (slot)
+		{
+		case 0: return &m_IdleAnim;
+		case 1: return &m_WalkAnim;
+		case 2: return &m_HurtAnim;
+		case 3: return &m_DeathAnim;
+		default: return nullptr;
+		}
+	}
+
+	bool Entity::Contains(std::span<const EngineCore::StringId> ids, EngineCore::StringId id)
+	{
+		return std::find(ids.begin(), ids.end(), id) != ids.end();
+	}
+
 	void Entity::SetWorld(TileMap* world)
 	{
 		m_World = world;
@@ -5,13 +5,19 @@
 #include "Game/TileMap.h"
 #include "Core/Animation.h"
 #include "Core/Data/Entity/EntityData.h"
+#include "Core/Data/Entity/EntityPhysics.h"
+#include "Game/Snapshot.h"
+#include <span>
+#include <memory_resource>
 
 namespace EngineGame
 {
 	class Entity
 	{
 	public:
-		Entity();
+		using allocator_type = std::pmr::polymorphic_allocator<>;
+
+		explicit Entity(const allocator_type& allocator = {});
 		virtual ~Entity() = default;
 
 		//Virtual methods
@@ -19,6 +25,15 @@ namespace EngineGame
 			const Camera2D& camera) = 0;
 		virtual void ApplyDefinition(const EngineData::EntityData& def) = 0;
 
+		//Hot reload, position, hp and state are kept
+		virtual void ReloadDefinition(const EngineData::EntityData& def);
+		virtual void RefreshAnimations(std::span<const EngineCore::StringId> changed);
+		EngineCore::StringId GetDefinitionKey() const { return m_Definition; }
+
+		//Snapshot, values only so restoring never allocates
+		void SaveState(EntitySnapshot& out) const;
+		void LoadState(const EntitySnapshot& state);
+
 		//Basic Methods
 		void SetWorld(TileMap* world);
 		
@@ -62,7 +77,15 @@ namespace EngineGame
 		virtual void UpdateDeath(float dt) = 0;
 		virtual void UpdatePhysics(float dt) = 0;
 
+		//Idle, walk, hurt and death are slots 0-3, subclasses number theirs after them
+		virtual const EngineCore::Animation* GetAnimationSlot(int slot) const;
+
 	protected:
+		static bool Contains(std::span<const EngineCore::StringId> ids, EngineCore::StringId id);
+
+		//Definition
+		EngineCore::StringId m_Definition;
+
 		//Movement
 		EngineMath::Vector2 m_Position{};
 		EngineMath::Vector2 m_Velocity{};
@@ -78,7 +101,8 @@ namespace EngineGame
 		float m_HurtTimer = 0.0f;
 		float m_HurtDuration = 0.3f;
 
-		//Animation
+		//Animation, arrays come from m_Allocator
+		allocator_type m_Allocator;
 		EngineCore::Animation m_IdleAnim;
 		EngineCore::Animation m_WalkAnim;
 		EngineCore::Animation m_HurtAnim;
@@ -103,14 +127,14 @@ namespace EngineGame
 
 		//Collider
 		EngineCore::AABB m_Collider{};
-		float m_ColliderWidth = 32.0f;
-		float m_ColliderHeight = 64.0f;
+		float m_ColliderWidth = EngineData::ENTITY_COLLIDER_WIDTH;
+		float m_ColliderHeight = EngineData::ENTITY_COLLIDER_HEIGHT;
 		bool m_IsGrounded = false;
 		bool m_ColliderEnabled = true;
 
 		//Physics
-		float m_Gravity = 200.0f;
-		float m_MaxFallSpeed = 800.0f;
+		float m_Gravity = EngineData::ENTITY_GRAVITY;
+		float m_MaxFallSpeed = EngineData::ENTITY_MAX_FALL_SPEED;
 
 		//World Reference
 		TileMap* m_World = nullptr;
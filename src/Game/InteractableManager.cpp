@@ -5,9 +5,17 @@
 #include "Game/Interactables/ChestInteractable.h"
 #include "Platform/LibraryManager.h"
 #include "Core/Log.h"
+#include "Core/PathUtil.h"
+#include "Core/StringId.h"
+#include <algorithm>
 
 namespace EngineGame
 {
+	//Interactable ids with engine behaviour
+	static constexpr EngineCore::StringId KEY_ID("Key");
+	static constexpr EngineCore::StringId DOOR_ID("Door");
+	static constexpr EngineCore::StringId CHEST_ID("Chest");
+
 	void InteractableManager::Update(Player& player)
 	{
 		m_Interacted = nullptr;
@@ -38,28 +46,46 @@ namespace EngineGame
 			it->DebugDraw(renderer, camera);
 	}
 
+	void InteractableManager::RefreshDefinitions(std::span<const EngineCore::StringId> changed)
+	{
+		//Values are read through the definition pointer every frame, only the image needs resolving again
+		for (auto& it : m_Interactables)
+		{
+			const auto* def = it->GetDefinition();
+			if (def && std::find(changed.begin(), changed.end(), def->key) != changed.end())
+				it->SetTexture(EnginePlatform::AssetManager::AcquireTexture(EngineCore::GetFile("Textures", def->imagePath)));
+		}
+	}
+
 	void InteractableManager::Clear()
 	{
-		m_Interactables.clear();
+		ReleaseList(m_Interactables);
 	}
 
 	void InteractableManager::Add(const InteractableInstance& instance)
 	{
-		auto interactable = CreateInteractable(instance);
+		if (!instance.def)
+			return;
+
+		InteractableInstance resolved = instance;
+		resolved.texture = EnginePlatform::AssetManager::AcquireTexture(
+			EngineCore::GetFile("Textures", instance.def->imagePath));
+
+		auto interactable = CreateInteractable(resolved);
 		if (interactable)
 			m_Interactables.push_back(std::move(interactable));
 	}
 
-	std::unique_ptr<Interactable> InteractableManager::CreateInteractable(const InteractableInstance& instance)
+	LevelPtr<Interactable> InteractableManager::CreateInteractable(const InteractableInstance& instance)
 	{
-		const std::string& id = instance.def->id;
+		EngineCore::StringId id = instance.def->key;
 
-		if (id == "Key")
-			return std::make_unique<KeyInteractable>(instance);
-		if(id == "Door")
-			return std::make_unique<DoorInteractable>(instance);
-		if(id == "Chest")
-			return std::make_unique<ChestInteractable>(instance);
+		if (id == KEY_ID)
+			return m_Arena.Create<KeyInteractable>(instance);
+		if(id == DOOR_ID)
+			return m_Arena.Create<DoorInteractable>(instance);
+		if(id == CHEST_ID)
+			return m_Arena.Create<ChestInteractable>(instance);
 
 		return nullptr;
 	}
@@ -87,17 +113,102 @@ namespace EngineGame
 		}
 	}
 
+	bool InteractableManager::SaveState(std::span<InteractableSnapshot> out, uint32_t& outCount) const
+	{
+		if (m_Interactables.size() > out.size())
+			return false;
+
+		for (size_t i = 0; i < m_Interactables.size(); i++)
+			m_Interactables[i]->SaveState(out[i]);
+
+		outCount = (uint32_t)m_Interactables.size();
+		return true;
+	}
+
+	bool InteractableManager::CanLoadState(std::span<const InteractableSnapshot> states) const
+	{
+		//Extra entries are keys spawned again, which needs the key definition
+		return states.size() <= m_Interactables.size() || EnginePlatform::InteractableLibrary::Get(KEY_ID) != nullptr;
+	}
+
+	bool InteractableManager::LoadState(std::span<const InteractableSnapshot> states)
+	{
+		if (!CanLoadState(states))
+			return false;
+
+		//The list only grows by spawned keys, the level's own interactables come first
+		if (states.size() < m_Interactables.size())
+			m_Interactables.erase(m_Interactables.begin() + states.size(), m_Interactables.end());
+
+		//Saved after a chest was opened, its key is spawned again
+		for (size_t i = m_Interactables.size(); i < states.size(); i++)
+			AddKey(states[i].position);
+
+		if (states.size() != m_Interactables.size())
+			return false;
+
+		for (size_t i = 0; i < m_Interactables.size(); i++)
+			m_Interactables[i]->LoadState(states[i]);
+
+		m_Interacted = nullptr;
+		return true;
+	}
+
+	void InteractableManager::Evict(const EngineCore::AABB& area, std::vector<SavedInteractable>& outSaved)
+	{
+		m_Interacted = nullptr;
+		std::erase_if(m_Interactables, [&](const LevelPtr<Interactable>& interactable)
+		{
+			EngineMath::Vector2 pos = interactable->GetPosition();
+			if (!interactable->GetDefinition() || pos.x < area.minX || pos.x >= area.maxX || pos.y < area.minY || pos.y >= area.maxY)
+				return false;
+
+			SavedInteractable& saved = outSaved.emplace_back();
+			saved.definition = interactable->GetDefinition()->key;
+			interactable->SaveState(saved.state);
+			return true;
+		});
+	}
+
+	void InteractableManager::Restore(const SavedInteractable& saved)
+	{
+		InteractableInstance instance;
+		instance.def = EnginePlatform::InteractableLibrary::Get(saved.definition);
+		instance.position = saved.state.position;
+		instance.collider = saved.state.collider;
+		instance.used = saved.state.used;
+		Add(instance);
+	}
+
+	bool InteractableManager::Move(const EngineMath::Vector2& from, const EngineMath::Vector2& to)
+	{
+		for (auto& interactable : m_Interactables)
+		{
+			if (interactable->GetPosition().x == from.x && interactable->GetPosition().y == from.y)
+			{
+				interactable->MoveTo(to);
+				return true;
+			}
+		}
+		return false;
+	}
+
 	void InteractableManager::SpawnKey(const EngineMath::Vector2& pos)
+	{
+		AddKey(pos + EngineMath::Vector2(16.0f, 0.0f));
+	}
+
+	void InteractableManager::AddKey(const EngineMath::Vector2& pos)
 	{
 		const EngineData::InteractableData* keyDef =
-			EnginePlatform::InteractableLibrary::Get("Key");
+			EnginePlatform::InteractableLibrary::Get(KEY_ID);
 
 		if (!keyDef)
 			return;
 
 		InteractableInstance instance;
 		instance.def = keyDef;
-		instance.position = pos + EngineMath::Vector2(16.0f, 0.0f);
+		instance.position = pos;
 		instance.collider.SetFromPositionSize(instance.position.x, instance.position.y, 50, 50);
 		instance.used = false;
 
@@ -2,27 +2,45 @@
 #include <functional>
 #include <vector>
 #include <memory>
+#include <span>
 #include "Game/Interactables/Interactable.h"
+#include "Game/LevelArena.h"
 
 namespace EngineGame
 {
 	class InteractableManager
 	{
 	public:
+		//Interactables and the list live in the level's arena
+		explicit InteractableManager(LevelArena& arena) : m_Arena(arena), m_Interactables(arena.GetResource()) {}
+
 		void Update(Player& player);
 		void Render(EngineCore::IRenderer* renderer, const EngineGame::Camera2D& camera);
 		void DebugDraw(EngineCore::IRenderer* renderer, const EngineGame::Camera2D& camera);
 		
 		void Add(const InteractableInstance& instance);
-		void Clear();
+		void Clear();		//Before the arena is reset
+		void RefreshDefinitions(std::span<const EngineCore::StringId> changed);	//Hot reload, re-resolves textures of edited definitions
 		
 		bool HasInteractableInRange() const;
 		void HandleInteraction(Player& player);
-		std::unique_ptr<Interactable> CreateInteractable(const InteractableInstance& instance);
+		LevelPtr<Interactable> CreateInteractable(const InteractableInstance& instance);
 
 		const EngineMath::Vector2 GetPosition() const { return m_Interacted->GetPosition(); }
 		void SpawnKey(const EngineMath::Vector2& pos);
 
+		//Snapshot, keys spawned after it was taken are dropped on restore
+		bool SaveState(std::span<InteractableSnapshot> out, uint32_t& outCount) const;
+		bool LoadState(std::span<const InteractableSnapshot> states);
+		bool CanLoadState(std::span<const InteractableSnapshot> states) const;	//Checked before any part of a scene is restored
+
+		//Streaming, interactables inside the area are saved and removed, Restore spawns one back
+		void Evict(const EngineCore::AABB& area, std::vector<SavedInteractable>& outSaved);
+		void Restore(const SavedInteractable& saved);
+
+		//Live link, the interactable at from, false when there is none
+		bool Move(const EngineMath::Vector2& from, const EngineMath::Vector2& to);
+
 		//Callback
 		void SetOnLevelComplete(std::function<void()> callback)
 		{
@@ -30,8 +48,10 @@ namespace EngineGame
 		}
 
 	private:
+		void AddKey(const EngineMath::Vector2& pos);
 
-		std::vector<std::unique_ptr<Interactable>> m_Interactables;
+		LevelArena& m_Arena;
+		LevelList<Interactable> m_Interactables;
 		Interactable* m_Interacted = nullptr;
 		std::function<void()> m_OnLevelComplete;
 	};
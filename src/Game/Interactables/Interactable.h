@@ -2,9 +2,9 @@
 #include "Core/IRenderer.h"
 #include "Game/Camera.h"
 #include "Platform/AssetManager.h"
-#include "Core/PathUtil.h"
 #include "Game/Player.h"
 #include "Core/Data/Interactable/InteractableData.h"
+#include "Game/Snapshot.h"
 
 namespace EngineGame
 {
@@ -14,6 +14,7 @@ namespace EngineGame
 		EngineMath::Vector2 position;
 		EngineCore::AABB collider;
 		bool used = false;
+		TextureHandle texture = INVALID_TEXTURE;	//Resolved by InteractableManager::Add
 	};
 
 	enum class InteractResult
@@ -37,9 +38,8 @@ namespace EngineGame
 			if (m_Instance.used || !m_Instance.def)
 				return;
 
-			std::string path = EngineCore::GetFile("Textures", m_Instance.def->imagePath);
-			EngineGame::Texture2D* tex = EnginePlatform::AssetManager::GetTexture(path);
-			
+			EngineGame::Texture2D* tex = EnginePlatform::AssetManager::GetTexture(m_Instance.texture);
+
 			if (!tex)
 				return;
 
@@ -69,6 +69,24 @@ namespace EngineGame
 		const EngineCore::AABB& GetCollider() const { return m_Instance.collider; }
 		bool IsUsed() const { return m_Instance.used; }
 		const EngineMath::Vector2 GetPosition() const { return m_Instance.position; }
+		const EngineData::InteractableData* GetDefinition() const { return m_Instance.def; }
+		void SetTexture(TextureHandle texture) { m_Instance.texture = texture; }
+
+		//Live link
+		void MoveTo(const EngineMath::Vector2& position)
+		{
+			m_Instance.collider.Translate(position - m_Instance.position);
+			m_Instance.position = position;
+		}
+
+		void SaveState(InteractableSnapshot& out) const
+		{
+			out.position = m_Instance.position;
+			out.collider = m_Instance.collider;
+			out.used = m_Instance.used;
+		}
+
+		void LoadState(const InteractableSnapshot& state) { m_Instance.used = state.used; }
 
 	protected:
 
@@ -0,0 +1,94 @@
+#pragma once
+#include <memory>
+#include <memory_resource>
+#include <vector>
+#include <cstddef>
+
+namespace EngineGame
+{
+	//Hands an object built in an arena back to it, the size is kept so a base pointer frees the whole object
+	struct LevelDeleter
+	{
+		std::pmr::memory_resource* resource = nullptr;
+		size_t size = 0;
+		size_t alignment = 0;
+
+		template<typename T>
+		void operator()(T* object) const
+		{
+			std::destroy_at(object);
+			resource->deallocate(object, size, alignment);
+		}
+	};
+
+	template<typename T>
+	using LevelPtr = std::unique_ptr<T, LevelDeleter>;
+
+	template<typename T>
+	using LevelList = std::pmr::vector<LevelPtr<T>>;
+
+	//Memory of everything one level spawns, the objects and their arrays sit together and go with one Reset.
+	//Same sized requests are pooled on top, so streamed chunks and snapshot respawns reuse what was freed.
+	class LevelArena
+	{
+	public:
+		LevelArena()
+			: m_Blocks(INITIAL_SIZE, &m_Upstream), m_Pool(&m_Blocks) {}
+
+		LevelArena(const LevelArena&) = delete;
+		LevelArena& operator=(const LevelArena&) = delete;
+
+		std::pmr::memory_resource* GetResource() { return &m_Pool; }
+
+		//Allocator aware types get the arena for their own arrays as well
+		template<typename T, typename... Args>
+		LevelPtr<T> Create(Args&&... args)
+		{
+			std::pmr::polymorphic_allocator<> allocator(&m_Pool);
+			T* object = allocator.new_object<T>(std::forward<Args>(args)...);
+			return LevelPtr<T>(object, LevelDeleter{ &m_Pool, sizeof(T), alignof(T) });
+		}
+
+		//Every object and list built from it has to be gone already
+		void Reset()
+		{
+			m_Pool.release();
+			m_Blocks.release();
+		}
+
+		size_t GetReservedBytes() const { return m_Upstream.reserved; }
+	private:
+		static constexpr size_t INITIAL_SIZE = 64 * 1024;
+
+		//Heap blocks behind the arena, counted for the load log
+		struct CountingResource : std::pmr::memory_resource
+		{
+			size_t reserved = 0;
+
+			void* do_allocate(size_t bytes, size_t alignment) override
+			{
+				reserved += bytes;
+				return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+			}
+
+			void do_deallocate(void* p, size_t bytes, size_t alignment) override
+			{
+				reserved -= bytes;
+				std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+			}
+
+			bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+		};
+
+		CountingResource m_Upstream;
+		std::pmr::monotonic_buffer_resource m_Blocks;
+		std::pmr::unsynchronized_pool_resource m_Pool;
+	};
+
+	//Drops a list's elements and its buffer before the arena under it is reset
+	template<typename T>
+	void ReleaseList(LevelList<T>& list)
+	{
+		LevelList<T>(list.get_allocator()).swap(list);
+	}
+}
\ No newline at end of file
@@ -1,32 +1,58 @@
 #include "Game/MapLoader.h"
 #include "Core/Data/Map/MapParser.h"
+#include "Core/Data/Map/MapFormat.h"
 #include "Core/JsonLoader.h"
+#include "Core/FileSystem.h"
 #include "Core/Log.h"
+#include <chrono>
 
 namespace EngineGame
 {
 	bool MapLoader::LoadFromFile(const std::string& path, EngineData::MapData& outMap)
 	{
-		nlohmann::json j;
+		std::string sourcePath = GetSourcePath(path);
 
-		if (!EngineCore::JsonLoader::LoadFromFile(path + ".json", j))
+		EngineCore::FileData file;
+		if (!EngineCore::FileSystem::Read(sourcePath, file))
 		{
 			EngineCore::Log::Write(
 				EngineCore::LogLevel::Error,
 				EngineCore::LogCategory::Scene,
-				"Failed to open map file: " + path
+				"Failed to open map file: " + sourcePath
 			);
+			return false;
 		}
-		
+
+		return LoadFromData(sourcePath, file, outMap);
+	}
+
+	std::string MapLoader::GetSourcePath(const std::string& path)
+	{
+		return path + (IsBinaryCurrent(path) ? ".ttmap" : ".json");
+	}
+
+	bool MapLoader::LoadFromData(const std::string& sourcePath, const EngineCore::FileData& file, EngineData::MapData& outMap)
+	{
+		if (sourcePath.ends_with(".ttmap"))
+			return ParseBinary(sourcePath, file, outMap);
+
+		return ParseJson(sourcePath, file, outMap);
+	}
+
+	bool MapLoader::ParseJson(const std::string& path, const EngineCore::FileData& file, EngineData::MapData& outMap)
+	{
 		outMap = {};
 
-		if (!EngineData::MapParser::Parse(j, outMap))
+		//Streamed, the json text and the tile buffer are the only large allocations
+		EngineData::MapParser parser(outMap);
+		if (!EngineCore::JsonLoader::Parse(path, file, parser) || !parser.Finish())
 		{
 			EngineCore::Log::Write(
 				EngineCore::LogLevel::Error,
 				EngineCore::LogCategory::Scene,
-				"Failed to parse map: " + path
+				"Failed to parse map: " + path + " " + parser.GetError()
 			);
+			return false;
 		}
 
 		EngineCore::Log::Write(
@@ -37,4 +63,128 @@ namespace EngineGame
 
 		return true;
 	}
+
+	bool MapLoader::IsBinaryCurrent(const std::string& path)
+	{
+		uint64_t binarySize, jsonSize;
+		int64_t binaryTime, jsonTime;
+
+		if (!EngineCore::FileSystem::GetStamp(path + ".ttmap", binarySize, binaryTime))
+			return false;
+
+		//Json saved from the editor after the last cook
+		if (EngineCore::FileSystem::GetStamp(path + ".json", jsonSize, jsonTime) && jsonTime > binaryTime)
+		{
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Warning,
+				EngineCore::LogCategory::Scene,
+				"Cooked map is older than its json, loading json : " + path
+			);
+			return false;
+		}
+
+		return true;
+	}
+
+	static bool ReadSpawns(const EngineData::MapFileSpawn* table, uint32_t count, const char* strings, uint64_t stringsSize, std::vector<EngineData::SpawnData>& outSpawns)
+	{
+		outSpawns.clear();
+		outSpawns.reserve(count);
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const EngineData::MapFileSpawn& spawn = table[i];
+			if (uint64_t(spawn.defOffset) + spawn.defLength > stringsSize)
+				return false;
+
+			outSpawns.push_back({ spawn.x, spawn.y, std::string(strings + spawn.defOffset, spawn.defLength) });
+		}
+
+		return true;
+	}
+
+	bool MapLoader::LoadBinary(const std::string& path, EngineData::MapData& outMap)
+	{
+		EngineCore::FileData file;
+		if (!EngineCore::FileSystem::Read(path, file))
+		{
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Error,
+				EngineCore::LogCategory::Scene,
+				"Failed to open map file: " + path
+			);
+			return false;
+		}
+
+		return ParseBinary(path, file, outMap);
+	}
+
+	bool MapLoader::ParseBinary(const std::string& path, const EngineCore::FileData& file, EngineData::MapData& outMap)
+	{
+		auto start = std::chrono::steady_clock::now();
+
+		if (file.GetSize() < sizeof(EngineData::MapFileHeader))
+		{
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Error,
+				EngineCore::LogCategory::Scene,
+				"Invalid binary map: " + path
+			);
+			return false;
+		}
+
+		const auto* header = reinterpret_cast<const EngineData::MapFileHeader*>(file.GetData());
+		uint64_t tileCount = uint64_t(header->width) * uint64_t(header->height);
+		uint64_t spawnTotal = uint64_t(header->spawnCount) + header->interactableCount + header->trapCount;
+
+		bool valid =
+			header->magic == EngineData::MAP_MAGIC &&
+			header->version == EngineData::MAP_VERSION &&
+			header->width > 0 && header->height > 0 &&
+			header->tilesOffset + tileCount <= file.GetSize() &&
+			header->spawnsOffset + spawnTotal * sizeof(EngineData::MapFileSpawn) <= file.GetSize() &&
+			header->stringsOffset + header->stringsSize <= file.GetSize();
+
+		if (!valid)
+		{
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Error,
+				EngineCore::LogCategory::Scene,
+				"Invalid binary map: " + path
+			);
+			return false;
+		}
+
+		outMap = {};
+		outMap.w = header->width;
+		outMap.h = header->height;
+		outMap.tSize = header->tileSize;
+
+		//Tiles stay inside the file buffer (mapped or read), TileMap copies them once
+		outMap.tiles = file.Slice(static_cast<size_t>(header->tilesOffset), static_cast<size_t>(tileCount));
+
+		const auto* spawns = reinterpret_cast<const EngineData::MapFileSpawn*>(file.GetData() + header->spawnsOffset);
+		const char* strings = reinterpret_cast<const char*>(file.GetData() + header->stringsOffset);
+
+		if (!ReadSpawns(spawns, header->spawnCount, strings, header->stringsSize, outMap.spawns) ||
+			!ReadSpawns(spawns + header->spawnCount, header->interactableCount, strings, header->stringsSize, outMap.interactables) ||
+			!ReadSpawns(spawns + header->spawnCount + header->interactableCount, header->trapCount, strings, header->stringsSize, outMap.traps))
+		{
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Error,
+				EngineCore::LogCategory::Scene,
+				"Corrupt spawn table in map: " + path
+			);
+			return false;
+		}
+
+		double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		EngineCore::Log::Write(
+			EngineCore::LogLevel::Info,
+			EngineCore::LogCategory::Scene,
+			"Map loaded : " + path + " (" + std::to_string(elapsedMs) + " ms)"
+		);
+
+		return true;
+	}
 }
\ No newline at end of file
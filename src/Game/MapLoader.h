@@ -1,11 +1,23 @@
 #pragma once
 #include "Core/Data/Map/MapData.h"
+#include "Core/FileData.h"
+#include <string>
 
 namespace EngineGame
 {
 	class MapLoader
 	{
 	public:
+		//Path without extension, a current .ttmap is preferred over the editor json
 		static bool LoadFromFile(const std::string& path, EngineData::MapData& outMap);
+		static bool LoadBinary(const std::string& path, EngineData::MapData& outMap);
+
+		//Split for batched reads, GetSourcePath picks the file and LoadFromData parses its bytes
+		static std::string GetSourcePath(const std::string& path);
+		static bool LoadFromData(const std::string& sourcePath, const EngineCore::FileData& file, EngineData::MapData& outMap);
+	private:
+		static bool IsBinaryCurrent(const std::string& path);
+		static bool ParseJson(const std::string& path, const EngineCore::FileData& file, EngineData::MapData& outMap);
+		static bool ParseBinary(const std::string& path, const EngineCore::FileData& file, EngineData::MapData& outMap);
 	};
-}
\ No newline at end of file
+}
@@ -16,6 +16,7 @@ namespace EngineGame
 	void Player::ApplyDefinition(const EngineData::EntityData& def)
 	{
 		//Base settings
+		m_Definition = def.key;
 		m_Speed = def.speed;
 		m_AttackDamage = def.attackDamage;
 		m_AttackInterval = def.attackInterval;
@@ -35,6 +36,41 @@ namespace EngineGame
 		m_CurrentAnim = &m_IdleAnim;
 	}
 
+	void Player::ReloadDefinition(const EngineData::EntityData& def)
+	{
+		Entity::ReloadDefinition(def);
+
+		//The combo list can change length, re-point the current attack by index
+		int current = -1;
+		for (size_t i = 0; i < m_AttackAnims.size(); i++)
+		{
+			if (m_CurrentAnim == &m_AttackAnims[i])
+				current = (int)i;
+		}
+
+		std::vector<EngineCore::Animation> attacks = std::move(m_AttackAnims);
+		m_AttackAnims.resize(def.attackAnims.size());
+		for (size_t i = 0; i < def.attackAnims.size(); i++)
+		{
+			if (i < attacks.size())
+				m_AttackAnims[i] = std::move(attacks[i]);
+			Animator::Refresh(m_AttackAnims[i], def.attackAnims[i]);
+		}
+
+		if (current >= 0)
+			m_CurrentAnim = current < (int)m_AttackAnims.size() ? &m_AttackAnims[current] : &m_IdleAnim;
+	}
+
+	void Player::RefreshAnimations(std::span<const EngineCore::StringId> changed)
+	{
+		Entity::RefreshAnimations(changed);
+		for (auto& anim : m_AttackAnims)
+		{
+			if (Contains(changed, anim.GetSource()))
+				Animator::Refresh(anim);
+		}
+	}
+
 	void Player::Update(float dt)
 	{
 		if (m_DamageFlashTimer > 0.0f)
@@ -68,8 +104,8 @@ namespace EngineGame
 		//Horizontal Movement
 		float moveX = 0.0f;
 
-		if (EngineCore::Input::IsKeyDown(EngineCore::KeyCode::A)) moveX -= 1.0f;
-		if (EngineCore::Input::IsKeyDown(EngineCore::KeyCode::D)) moveX += 1.0f;
+		if (m_Input->IsKeyDown(EngineCore::KeyCode::A)) moveX -= 1.0f;
+		if (m_Input->IsKeyDown(EngineCore::KeyCode::D)) moveX += 1.0f;
 	
 		float targetSpeed = moveX * m_Speed;
 		float accel = m_IsGrounded ? m_Acceleration : m_Acceleration * m_AirControl;
@@ -91,7 +127,7 @@ namespace EngineGame
 		m_CurrentAnim->Update(dt);
 
 		//Jump
-		if (EngineCore::Input::IsKeyPressed(EngineCore::KeyCode::W))
+		if (m_Input->IsKeyPressed(EngineCore::KeyCode::W))
 		{
 			m_JumpBufferTimer = m_JumpBufferTime;
 		}
@@ -170,7 +206,7 @@ namespace EngineGame
 		};
 		EngineCore::SpriteFlip flip = m_FacingRight ? EngineCore::SpriteFlip::None : EngineCore::SpriteFlip::Horizontal;
 
-		Texture2D* currentTexture = m_CurrentAnim->GetTexture();
+		Texture2D* currentTexture = EnginePlatform::AssetManager::GetTexture(m_CurrentAnim->GetTexture());
 
 		renderer->DrawTexture(
 			currentTexture,
@@ -225,7 +261,7 @@ namespace EngineGame
 		{
 			m_CurrentAnim->Update(dt);
 
-			if (EngineCore::Input::IsKeyPressed(EngineCore::KeyCode::E))
+			if (m_Input->IsKeyPressed(EngineCore::KeyCode::E))
 				m_ComboQueued = true;
 
 			if (m_CurrentAnim->IsFinished())
@@ -247,7 +283,7 @@ namespace EngineGame
 			return;
 		}
 
-		if (EngineCore::Input::IsKeyPressed(EngineCore::KeyCode::E) && m_AttackCooldown <= 0.0f)
+		if (m_Input->IsKeyPressed(EngineCore::KeyCode::E) && m_AttackCooldown <= 0.0f)
 		{
 			m_AttackCooldown = m_AttackInterval;
 			StartAttack(AttackStage::Attack1);
@@ -336,6 +372,43 @@ namespace EngineGame
 
 	#pragma endregion
 
+	void Player::SaveState(PlayerSnapshot& out) const
+	{
+		Entity::SaveState(out.entity);
+		out.state = (uint8_t)m_State;
+		out.attackStage = (uint8_t)m_AttackStage;
+		out.comboQueued = m_ComboQueued;
+		out.hasKey = m_HasKey;
+		out.knockbackVel = m_KnockbackVel;
+		out.spawnPoint = m_SpawnPoint;
+		out.deathTimer = m_DeathTimer;
+		out.coyoteTimer = m_CoyoteTimer;
+		out.jumpBufferTimer = m_JumpBufferTimer;
+	}
+
+	void Player::LoadState(const PlayerSnapshot& state)
+	{
+		Entity::LoadState(state.entity);
+		m_State = (PlayerState)state.state;
+		m_AttackStage = (AttackStage)state.attackStage;
+		m_ComboQueued = state.comboQueued;
+		m_HasKey = state.hasKey;
+		m_KnockbackVel = state.knockbackVel;
+		m_SpawnPoint = state.spawnPoint;
+		m_DeathTimer = state.deathTimer;
+		m_CoyoteTimer = state.coyoteTimer;
+		m_JumpBufferTimer = state.jumpBufferTimer;
+	}
+
+	const EngineCore::Animation* Player::GetAnimationSlot(int slot) const
+	{
+		if (slot < 4)
+			return Entity::GetAnimationSlot(slot);
+
+		size_t index = slot - 4;
+		return index < m_AttackAnims.size() ? &m_AttackAnims[index] : nullptr;
+	}
+
 	void Player::Reset()
 	{
 		m_Position = m_SpawnPoint;
@@ -31,13 +31,19 @@ namespace EngineGame
 					const Camera2D& camera) override;
 		void TakeDamage(float amount, float objectDir) override;
 		void ApplyDefinition(const EngineData::EntityData& def) override;
+		void ReloadDefinition(const EngineData::EntityData& def) override;
+		void RefreshAnimations(std::span<const EngineCore::StringId> changed) override;
 
 		//Player Spesific Methods
 		void Update(float dt);
 		void SetSpawnPoint(const EngineMath::Vector2& pos) { m_SpawnPoint = pos; }
+		void SetInput(const EngineCore::InputState* input) { m_Input = input; }	//The owning game's, not the window's when headless
 		void Respawn();
 		void Reset();
 
+		void SaveState(PlayerSnapshot& out) const;
+		void LoadState(const PlayerSnapshot& state);
+
 		//Player Key Holder
 		void TakeKey() { m_HasKey = true; }
 		bool HasKey() const { return m_HasKey; }
@@ -49,6 +55,7 @@ namespace EngineGame
 		void UpdateHurt(float dt) override;
 		void UpdateDeath(float dt) override;
 		void UpdatePhysics(float dt) override;
+		const EngineCore::Animation* GetAnimationSlot(int slot) const override;
 
 	private:
 		//Player Spesific Methods
@@ -90,7 +97,7 @@ namespace EngineGame
 		EngineMath::Vector2 m_SpawnPoint;
 
 		//Physics
-		float m_JumpForce = 200.0f;
+		float m_JumpForce = EngineData::PLAYER_JUMP_FORCE;
 		float m_CoyoteTime = 0.1f;
 		float m_CoyoteTimer = 0.0f;
 		float m_JumpBufferTimer = 0.0f;
@@ -101,5 +108,8 @@ namespace EngineGame
 
 		//Key
 		bool m_HasKey = false;
+
+		//Input
+		const EngineCore::InputState* m_Input = &EngineCore::Input::GetState();
 	};
 }
\ No newline at end of file
@@ -0,0 +1,134 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+#include "Core/Math/Vector2.h"
+#include "Core/AABB.h"
+#include "Core/Animation.h"
+#include "Core/StringId.h"
+
+namespace EngineGame
+{
+	//Plain values of everything that changes while a level is played,
+	//taking or restoring one copies fields into objects that already exist
+
+	struct EntitySnapshot
+	{
+		static constexpr int MAX_ANIMATIONS = 8;
+
+		EngineMath::Vector2 position;
+		EngineMath::Vector2 velocity;
+		EngineCore::AABB collider;
+		float hp;
+		float hurtTimer;
+		float attackCooldown;
+		float damageFlashTimer;
+
+		bool facingRight;
+		bool isDead;
+		bool isMoving;
+		bool isAttacking;
+		bool hasHitThisAttack;
+		bool isGrounded;
+		bool colliderEnabled;
+
+		int8_t currentAnim;		//Animation slot, -1 when none
+		uint8_t animationCount;
+		EngineCore::AnimationPlayback animations[MAX_ANIMATIONS];
+	};
+
+	struct PlayerSnapshot
+	{
+		EntitySnapshot entity;
+		uint8_t state;
+		uint8_t attackStage;
+		bool comboQueued;
+		bool hasKey;
+		EngineMath::Vector2 knockbackVel;
+		EngineMath::Vector2 spawnPoint;
+		float deathTimer;
+		float coyoteTimer;
+		float jumpBufferTimer;
+	};
+
+	struct EnemySnapshot
+	{
+		EntitySnapshot entity;
+		uint8_t state;
+		bool canDealDamage;
+		float stateTimer;
+		float direction;
+		float attackWindUpTimer;
+		EngineMath::Vector2 knockbackVel;
+		float knockbackTimer;
+	};
+
+	//Shared by every trap type, each one keeps the fields it uses
+	struct TrapSnapshot
+	{
+		EngineMath::Vector2 position;
+		EngineCore::AABB collider;
+		float timer;
+		float direction;
+		bool active;
+	};
+
+	struct InteractableSnapshot
+	{
+		EngineMath::Vector2 position;
+		EngineCore::AABB collider;
+		bool used;
+	};
+
+	struct CameraSnapshot
+	{
+		float x;
+		float y;
+		float shakeTimer;
+		float shakeDuration;
+		float shakeStrength;
+	};
+
+	struct SceneSnapshot
+	{
+		static constexpr size_t MAX_ENEMIES = 64;
+		static constexpr size_t MAX_TRAPS = 64;
+		static constexpr size_t MAX_INTERACTABLES = 32;
+
+		bool valid = false;
+		EngineCore::StringId map;		//Only restored into the level it was taken in
+		bool levelCompleted;
+
+		PlayerSnapshot player;
+		CameraSnapshot camera;
+
+		uint32_t enemyCount;
+		EnemySnapshot enemies[MAX_ENEMIES];
+		uint32_t trapCount;
+		TrapSnapshot traps[MAX_TRAPS];
+		uint32_t interactableCount;
+		InteractableSnapshot interactables[MAX_INTERACTABLES];
+	};
+
+	static_assert(std::is_trivially_copyable_v<SceneSnapshot>, "Snapshots are copied as raw bytes");
+
+	//Streamed worlds keep these for chunks that were evicted, definitions by id so hot reload still applies
+	struct SavedEnemy
+	{
+		EngineCore::StringId definition;
+		EnemySnapshot state;
+	};
+
+	struct SavedTrap
+	{
+		EngineCore::StringId definition;
+		EngineMath::Vector2 origin;		//Where the map placed it, patrols are built around it
+		TrapSnapshot state;
+	};
+
+	struct SavedInteractable
+	{
+		EngineCore::StringId definition;
+		InteractableSnapshot state;
+	};
+}
\ No newline at end of file
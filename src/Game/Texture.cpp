@@ -1,29 +1,56 @@
 #include "Game/Texture.h"
 #include "SDL3_image/SDL_image.h"
 #include "Core/Log.h"
+#include "Core/FileSystem.h"
 
 namespace EngineGame
 {
 	Texture2D::Texture2D(SDL_Renderer* renderer, const std::string& path)
 	{
-		SDL_Surface* surface = IMG_Load(path.c_str());
-		if (!surface)
+		EngineCore::FileData file;
+		if (!EngineCore::FileSystem::Read(path, file))
 			return;
 
-		m_Texture = SDL_CreateTextureFromSurface(renderer, surface);
-
-		m_Width = surface->w;
-		m_Height = surface->h;
+		SDL_Surface* surface = IMG_Load_IO(SDL_IOFromConstMem(file.GetData(), file.GetSize()), true);
+		if (!surface)
+			return;
 
+		Upload(renderer, surface);
 		SDL_DestroySurface(surface);
 	}
 
 	Texture2D::~Texture2D()
+	{
+		Release();
+	}
+
+	void Texture2D::Release()
 	{
 		if (m_Texture)
 		{
 			SDL_DestroyTexture(m_Texture);
 			m_Texture = nullptr;
 		}
+
+		m_ByteSize = 0;
+	}
+
+	bool Texture2D::Upload(SDL_Renderer* renderer, SDL_Surface* surface)
+	{
+		if (!renderer || !surface)
+			return false;
+
+		SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+		if (!texture)
+			return false;
+
+		if (m_Texture)
+			SDL_DestroyTexture(m_Texture);
+
+		m_Texture = texture;
+		m_Width = surface->w;
+		m_Height = surface->h;
+		m_ByteSize = (size_t)texture->w * texture->h * SDL_BYTESPERPIXEL(texture->format);
+		return true;
 	}
 }
\ No newline at end of file
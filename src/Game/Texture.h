@@ -1,15 +1,32 @@
 #pragma once
 #include <SDL3/SDL.h>
 #include <string>
+#include <cstdint>
 
 namespace EngineGame
 {
+	//Index of a texture slot inside AssetManager, 0 is never a valid slot
+	using TextureHandle = uint32_t;
+	constexpr TextureHandle INVALID_TEXTURE = 0;
+
 	class Texture2D
 	{
 	public:
+		Texture2D() = default;
 		Texture2D(SDL_Renderer* renderer, const std::string& path);
 		~Texture2D();
 
+		Texture2D(const Texture2D&) = delete;
+		Texture2D& operator=(const Texture2D&) = delete;
+
+		//Streaming
+		bool Upload(SDL_Renderer* renderer, SDL_Surface* surface);
+		void Release();
+		bool IsReady() const { return m_Texture != nullptr; }
+		size_t GetByteSize() const { return m_ByteSize; }
+		void SetHandle(TextureHandle handle) { m_Handle = handle; }
+		TextureHandle GetHandle() const { return m_Handle; }
+
 		SDL_Texture* Get() const { return m_Texture; }
 		int GetWidth() const { return m_Width; }
 		int GetHeight() const { return m_Height; }
@@ -17,5 +34,7 @@ namespace EngineGame
 		SDL_Texture* m_Texture = nullptr;
 		int m_Width = 0;
 		int m_Height = 0;
+		size_t m_ByteSize = 0;
+		TextureHandle m_Handle = INVALID_TEXTURE;
 	};
 }
\ No newline at end of file
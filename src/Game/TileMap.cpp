@@ -1,30 +1,114 @@
 #include "TileMap.h"
 #include "Platform/AssetManager.h"
 #include "Core/PathUtil.h"
+#include <cstring>
+#include <algorithm>
 
 namespace EngineGame
 {
-	TileMap::TileMap(int width, int height, int tileSize)
-		: m_Width(width), m_Height(height), m_TileSize(tileSize)
+	TileMap::TileMap(int width, int height, int tileSize, int chunkSize)
+		: m_Width(width), m_Height(height), m_TileSize(tileSize), m_ChunkSize(chunkSize)
 	{
-		m_Tiles.resize(width * height, TileType::None);
+		if (chunkSize > 0)
+		{
+			m_ChunksX = (width + chunkSize - 1) / chunkSize;
+			m_ChunkSlots.assign(size_t(m_ChunksX) * ((height + chunkSize - 1) / chunkSize), -1);
+		}
+		else
+		{
+			m_Tiles.resize(width * height, TileType::None);
+		}
 
-		m_GroundTex = nullptr;
-		m_WallTex = nullptr;
+		m_GroundTex = INVALID_TEXTURE;
+		m_WallTex = INVALID_TEXTURE;
 	}
 
 	void TileMap::LoadAssets()
 	{
-		m_GroundTex = EnginePlatform::AssetManager::GetTexture(EngineCore::GetFile("Textures", "ground.png"));
-		m_WallTex = EnginePlatform::AssetManager::GetTexture(EngineCore::GetFile("Textures", "wall.png"));
+		m_GroundTex = EnginePlatform::AssetManager::AcquireTexture(EngineCore::GetFile("Textures", GROUND_TEXTURE));
+		m_WallTex = EnginePlatform::AssetManager::AcquireTexture(EngineCore::GetFile("Textures", WALL_TEXTURE));
+	}
+
+	void TileMap::SetTiles(const uint8_t* tiles, size_t count)
+	{
+		//TileType is one byte, the map layer is copied straight into the grid
+		static_assert(sizeof(TileType) == sizeof(uint8_t));
+
+		if (m_ChunkSize > 0 || count != m_Tiles.size())
+			return;
+
+		std::memcpy(m_Tiles.data(), tiles, count);
+	}
+
+	void TileMap::SetTile(int x, int y, TileType type)
+	{
+		if (m_ChunkSize > 0 || x < 0 || x >= m_Width || y < 0 || y >= m_Height)
+			return;
+
+		m_Tiles[y * m_Width + x] = type;
+	}
+
+	void TileMap::SetChunk(int chunkX, int chunkY, const uint8_t* tiles)
+	{
+		if (m_ChunkSize == 0 || chunkX < 0 || chunkX >= m_ChunksX || chunkY < 0)
+			return;
+
+		size_t index = size_t(chunkY) * m_ChunksX + chunkX;
+		if (index >= m_ChunkSlots.size())
+			return;
+
+		//Slots are reused, the pool only grows to the most chunks ever resident at once
+		size_t cells = size_t(m_ChunkSize) * m_ChunkSize;
+		int32_t& slot = m_ChunkSlots[index];
+		if (slot < 0)
+		{
+			if (!m_FreeSlots.empty())
+			{
+				slot = m_FreeSlots.back();
+				m_FreeSlots.pop_back();
+			}
+			else
+			{
+				slot = (int32_t)(m_Tiles.size() / cells);
+				m_Tiles.resize(m_Tiles.size() + cells);
+			}
+		}
+
+		std::memcpy(m_Tiles.data() + size_t(slot) * cells, tiles, cells);
+	}
+
+	void TileMap::ClearChunk(int chunkX, int chunkY)
+	{
+		if (m_ChunkSize == 0 || chunkX < 0 || chunkX >= m_ChunksX || chunkY < 0)
+			return;
+
+		size_t index = size_t(chunkY) * m_ChunksX + chunkX;
+		if (index >= m_ChunkSlots.size() || m_ChunkSlots[index] < 0)
+			return;
+
+		m_FreeSlots.push_back(m_ChunkSlots[index]);
+		m_ChunkSlots[index] = -1;
 	}
 
 	TileType TileMap::GetTile(int x, int y) const
+	{
+		//Unloaded chunks are solid, nothing walks or falls into a chunk that is not there
+		return GetCell(x, y, TileType::Wall);
+	}
+
+	TileType TileMap::GetCell(int x, int y, TileType unloaded) const
 	{
 		if (x < 0 || x >= m_Width || y < 0 || y >= m_Height)
 			return TileType::Wall;
 
-		return m_Tiles[y * m_Width + x];
+		if (m_ChunkSize == 0)
+			return m_Tiles[y * m_Width + x];
+
+		int32_t slot = m_ChunkSlots[size_t(y / m_ChunkSize) * m_ChunksX + x / m_ChunkSize];
+		if (slot < 0)
+			return unloaded;
+
+		return m_Tiles[size_t(slot) * m_ChunkSize * m_ChunkSize + size_t(y % m_ChunkSize) * m_ChunkSize + x % m_ChunkSize];
 	}
 
 	void TileMap::Draw(EngineCore::IRenderer* renderer, const Camera2D& camera) const
@@ -38,12 +122,15 @@ namespace EngineGame
 		int endX = startX + (int)(800 / m_TileSize) + 4;
 		int endY = startY + (int)(600 / m_TileSize) + 4;
 
+		Texture2D* groundTex = EnginePlatform::AssetManager::GetTexture(m_GroundTex);
+		Texture2D* wallTex = EnginePlatform::AssetManager::GetTexture(m_WallTex);
+
 		Texture2D* t = nullptr;
 		for (int y = startY; y <= endY; y++)
 		{
 			for (int x = startX; x <= endX; x++) 
 			{
-				TileType tile = GetTile(x, y);
+				TileType tile = GetCell(x, y, TileType::None);
 				if (tile == TileType::None)
 					continue;
 
@@ -53,7 +140,7 @@ namespace EngineGame
 				float screenX = worldX - camX;
 				float screenY = worldY - camY;
 
-				t = tile == TileType::Wall ? m_WallTex : m_GroundTex;
+				t = tile == TileType::Wall ? wallTex : groundTex;
 
 				if (!t) continue;
 
@@ -69,11 +156,17 @@ namespace EngineGame
 		float camX = camera.GetX();
 		float camY = camera.GetY();
 
-		for (int y = 0; y < m_Height; y++)
+		//Visible cells only, streamed worlds can be far larger than the screen
+		int startX = (std::max)(0, (int)(camX / m_TileSize) - 1);
+		int startY = (std::max)(0, (int)(camY / m_TileSize) - 1);
+		int endX = (std::min)(m_Width - 1, startX + (int)(800 / m_TileSize) + 2);
+		int endY = (std::min)(m_Height - 1, startY + (int)(600 / m_TileSize) + 2);
+
+		for (int y = startY; y <= endY; y++)
 		{
-			for (int x = 0; x < m_Width; x++)
+			for (int x = startX; x <= endX; x++)
 			{
-				TileType tile = GetTile(x, y);
+				TileType tile = GetCell(x, y, TileType::None);
 				if (tile == TileType::None)
 					continue;
 
@@ -4,11 +4,12 @@
 #include "Core/AABB.h"
 #include "Game/Texture.h"
 #include <vector>
+#include <cstdint>
 #include "Core/Math/Vector2.h"
 
 namespace EngineGame
 {
-	enum class TileType
+	enum class TileType : uint8_t
 	{
 		None = 0,
 		Ground,
@@ -18,7 +19,11 @@ namespace EngineGame
 	class TileMap
 	{
 	public:
-		TileMap(int width, int height, int tileSize);
+		static constexpr const char* GROUND_TEXTURE = "ground.png";
+		static constexpr const char* WALL_TEXTURE = "wall.png";
+
+		//chunkSize > 0 streams the grid, only resident chunks hold cells and every other cell reads as Wall
+		TileMap(int width, int height, int tileSize, int chunkSize = 0);
 		
 		void LoadAssets();
 		
@@ -44,15 +49,30 @@ namespace EngineGame
 		int GetHeight() const { return m_Height; }
 		int GetWidth() const { return m_Width; }
 		const std::vector<TileType>& GetTiles() const { return m_Tiles; }
-		void SetTiles(const std::vector<TileType>& tiles) { m_Tiles = tiles; }
+		void SetTiles(const uint8_t* tiles, size_t count);
+		void SetTile(int x, int y, TileType type);	//Whole grid maps only
+
+		//Streamed chunks
+		bool IsChunked() const { return m_ChunkSize > 0; }
+		int GetChunkSize() const { return m_ChunkSize; }
+		void SetChunk(int chunkX, int chunkY, const uint8_t* tiles);	//chunkSize * chunkSize cells
+		void ClearChunk(int chunkX, int chunkY);
 	private:
+		TileType GetCell(int x, int y, TileType unloaded) const;
+
 		int m_Width;
 		int m_Height;
 		int m_TileSize;
 
-		Texture2D* m_GroundTex;
-		Texture2D* m_WallTex;
+		TextureHandle m_GroundTex;
+		TextureHandle m_WallTex;
+
+		std::vector<TileType> m_Tiles;	//Whole grid, or chunk slots back to back when streamed
 
-		std::vector<TileType> m_Tiles;
+		//Streaming
+		int m_ChunkSize = 0;
+		int m_ChunksX = 0;
+		std::vector<int32_t> m_ChunkSlots;	//Per chunk, slot in m_Tiles or -1
+		std::vector<int32_t> m_FreeSlots;
 	};
 }
\ No newline at end of file
@@ -1,9 +1,17 @@
 #include "Game/TrapManager.h"
 #include "Game/Traps/SawTrap.h"
 #include "Game/Traps/FireTrap.h"
+#include "Core/PathUtil.h"
+#include "Platform/LibraryManager.h"
+#include "Core/StringId.h"
+#include <algorithm>
 
 namespace EngineGame
 {
+	//Trap ids with engine behaviour
+	static constexpr EngineCore::StringId FIRE_ID("Fire");
+	static constexpr EngineCore::StringId SAW_ID("Saw");
+
 	void TrapManager::Update(float dt, Player& player)
 	{
 		for (auto& it : m_Traps)
@@ -24,22 +32,111 @@ namespace EngineGame
 
 	void TrapManager::Add(const TrapInstance& instance)
 	{
-		auto trap = CreateTrap(instance);
+		if (!instance.def)
+			return;
+
+		TrapInstance resolved = instance;
+		resolved.texture = EnginePlatform::AssetManager::AcquireTexture(
+			EngineCore::GetFile("Textures", instance.def->imagePath));
+
+		auto trap = CreateTrap(resolved);
 		if (trap)
 			m_Traps.push_back(std::move(trap));
 	}
 
+	void TrapManager::RefreshDefinitions(std::span<const EngineCore::StringId> changed)
+	{
+		//Values are read through the definition pointer every frame, only the image needs resolving again
+		for (auto& it : m_Traps)
+		{
+			const auto* def = it->GetDefinition();
+			if (def && std::find(changed.begin(), changed.end(), def->key) != changed.end())
+				it->SetTexture(EnginePlatform::AssetManager::AcquireTexture(EngineCore::GetFile("Textures", def->imagePath)));
+		}
+	}
+
+	bool TrapManager::SaveState(std::span<TrapSnapshot> out, uint32_t& outCount) const
+	{
+		if (m_Traps.size() > out.size())
+			return false;
+
+		for (size_t i = 0; i < m_Traps.size(); i++)
+			m_Traps[i]->SaveState(out[i]);
+
+		outCount = (uint32_t)m_Traps.size();
+		return true;
+	}
+
+	bool TrapManager::CanLoadState(std::span<const TrapSnapshot> states) const
+	{
+		//Traps are only created by the level load, the list never changes while it is played
+		return states.size() == m_Traps.size();
+	}
+
+	bool TrapManager::LoadState(std::span<const TrapSnapshot> states)
+	{
+		if (!CanLoadState(states))
+			return false;
+
+		for (size_t i = 0; i < m_Traps.size(); i++)
+			m_Traps[i]->LoadState(states[i]);
+
+		return true;
+	}
+
+	void TrapManager::Evict(const EngineCore::AABB& area, std::vector<SavedTrap>& outSaved)
+	{
+		std::erase_if(m_Traps, [&](const LevelPtr<Trap>& trap)
+		{
+			EngineMath::Vector2 pos = trap->GetPosition();
+			if (!trap->GetDefinition() || pos.x < area.minX || pos.x >= area.maxX || pos.y < area.minY || pos.y >= area.maxY)
+				return false;
+
+			SavedTrap& saved = outSaved.emplace_back();
+			saved.definition = trap->GetDefinition()->key;
+			saved.origin = trap->GetOrigin();
+			trap->SaveState(saved.state);
+			return true;
+		});
+	}
+
+	void TrapManager::Restore(const SavedTrap& saved)
+	{
+		TrapInstance instance;
+		instance.def = EnginePlatform::TrapLibrary::Get(saved.definition);
+		instance.position = saved.origin;
+
+		//Built where it was placed, then put back where it was when its chunk went
+		size_t count = m_Traps.size();
+		Add(instance);
+		if (m_Traps.size() > count)
+			m_Traps.back()->LoadState(saved.state);
+	}
+
+	int TrapManager::Move(const EngineMath::Vector2& from, const EngineMath::Vector2& to)
+	{
+		for (size_t i = 0; i < m_Traps.size(); i++)
+		{
+			if (m_Traps[i]->GetOrigin().x == from.x && m_Traps[i]->GetOrigin().y == from.y)
+			{
+				m_Traps[i]->MoveTo(to);
+				return (int)i;
+			}
+		}
+		return -1;
+	}
+
 	void TrapManager::Clear()
 	{
-		m_Traps.clear();
+		ReleaseList(m_Traps);
 	}
 
-	std::unique_ptr<Trap> TrapManager::CreateTrap(const TrapInstance& instance)
+	LevelPtr<Trap> TrapManager::CreateTrap(const TrapInstance& instance)
 	{
-		if(instance.def->id == "Fire")
-			return std::make_unique<FireTrap>(instance);
-		if(instance.def->id == "Saw")
-			return std::make_unique<SawTrap>(instance);
+		if(instance.def->key == FIRE_ID)
+			return m_Arena.Create<FireTrap>(instance);
+		if(instance.def->key == SAW_ID)
+			return m_Arena.Create<SawTrap>(instance);
 
 		return nullptr;
 	}
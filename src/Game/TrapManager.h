@@ -1,22 +1,41 @@
 #pragma once
 #include <vector>
 #include <memory>
+#include <span>
 #include "Game/Traps/Trap.h"
+#include "Game/LevelArena.h"
 
 namespace EngineGame
 {
 	class TrapManager
 	{
 	public:
+		//Traps and the list live in the level's arena
+		explicit TrapManager(LevelArena& arena) : m_Arena(arena), m_Traps(arena.GetResource()) {}
+
 		void Update(float dt, Player& player);
 		void Render(EngineCore::IRenderer* renderer, const EngineGame::Camera2D& camera);
 		void DebugDraw(EngineCore::IRenderer* renderer, const EngineGame::Camera2D& camera);
 
 		void Add(const TrapInstance& instance);
-		void Clear();
-		std::unique_ptr<Trap> CreateTrap(const TrapInstance& instance);
+		void Clear();		//Before the arena is reset
+		void RefreshDefinitions(std::span<const EngineCore::StringId> changed);	//Hot reload, re-resolves textures of edited definitions
+		LevelPtr<Trap> CreateTrap(const TrapInstance& instance);
+
+		//Snapshot, false when the traps do not fit or do not match the saved ones
+		bool SaveState(std::span<TrapSnapshot> out, uint32_t& outCount) const;
+		bool LoadState(std::span<const TrapSnapshot> states);
+		bool CanLoadState(std::span<const TrapSnapshot> states) const;	//Checked before any part of a scene is restored
+
+		//Streaming, traps inside the area are saved and removed, Restore spawns one back
+		void Evict(const EngineCore::AABB& area, std::vector<SavedTrap>& outSaved);
+		void Restore(const SavedTrap& saved);
+
+		//Live link, moves the trap the map placed at from and returns its index, -1 when there is none
+		int Move(const EngineMath::Vector2& from, const EngineMath::Vector2& to);
 
 	private:
-		std::vector<std::unique_ptr<Trap>> m_Traps;
+		LevelArena& m_Arena;
+		LevelList<Trap> m_Traps;
 	};
 }
\ No newline at end of file
@@ -34,6 +34,20 @@ namespace EngineGame
 			if (EngineMath::AABBIntersectsAABB(GetCollider(), player.GetCollider()))
 				player.TakeDamage(m_Instance.def->damagePerSecond * dt, 0.0f);
 		}
+
+		void SaveState(TrapSnapshot& out) const override
+		{
+			Trap::SaveState(out);
+			out.timer = m_Timer;
+			out.active = m_Active;
+		}
+
+		void LoadState(const TrapSnapshot& state) override
+		{
+			Trap::LoadState(state);
+			m_Timer = state.timer;
+			m_Active = state.active;
+		}
 		
 	private:
 		float m_Timer = 0.0f;
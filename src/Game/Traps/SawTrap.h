@@ -49,7 +49,27 @@ namespace EngineGame
 				}
 			}
 		}
-		
+
+		void SaveState(TrapSnapshot& out) const override
+		{
+			Trap::SaveState(out);
+			out.timer = m_DamageTimer;
+			out.direction = m_Direction;
+		}
+
+		void LoadState(const TrapSnapshot& state) override
+		{
+			Trap::LoadState(state);
+			m_DamageTimer = state.timer;
+			m_Direction = state.direction;
+		}
+
+	protected:
+		void OnMoved(const EngineMath::Vector2& delta) override
+		{
+			m_PointA += delta;
+			m_PointB += delta;
+		}
 
 	private:
 		EngineMath::Vector2 m_PointA;
@@ -1,10 +1,10 @@
 #pragma once
 #include "Core/AABB.h"
 #include "Core/IRenderer.h"
-#include "Core/PathUtil.h"
 #include "Platform/AssetManager.h"
 #include "Game/Camera.h"
 #include "Core/Data/Interactable/TrapData.h"
+#include "Game/Snapshot.h"
 
 namespace EngineGame
 {
@@ -13,6 +13,7 @@ namespace EngineGame
 		const EngineData::TrapData* def = nullptr;
 		EngineMath::Vector2 position;
 		EngineCore::AABB collider;
+		TextureHandle texture = INVALID_TEXTURE;	//Resolved by TrapManager::Add
 	};
 
 	class Player;
@@ -20,7 +21,7 @@ namespace EngineGame
 	class Trap
 	{
 	public:
-		explicit Trap(const TrapInstance& instance) : m_Instance(instance) {}
+		explicit Trap(const TrapInstance& instance) : m_Instance(instance), m_Origin(instance.position) {}
 
 		virtual ~Trap() = default;
 
@@ -32,8 +33,7 @@ namespace EngineGame
 			if (!m_Instance.def)
 				return;
 
-			std::string path = EngineCore::GetFile("Textures", m_Instance.def->imagePath);
-			EngineGame::Texture2D* tex = EnginePlatform::AssetManager::GetTexture(path);
+			EngineGame::Texture2D* tex = EnginePlatform::AssetManager::GetTexture(m_Instance.texture);
 
 			if (!tex)
 				return;
@@ -63,8 +63,36 @@ namespace EngineGame
 
 		const EngineCore::AABB& GetCollider() const { return m_Instance.collider; }
 		const EngineMath::Vector2 GetPosition() const { return m_Instance.position; }
+		const EngineMath::Vector2& GetOrigin() const { return m_Origin; }	//Where the map placed it
+		const EngineData::TrapData* GetDefinition() const { return m_Instance.def; }
+		void SetTexture(TextureHandle texture) { m_Instance.texture = texture; }
+
+		//Live link, the trap and its placement shift by the same amount
+		void MoveTo(const EngineMath::Vector2& origin)
+		{
+			EngineMath::Vector2 delta = origin - m_Origin;
+			m_Origin = origin;
+			m_Instance.position += delta;
+			m_Instance.collider.Translate(delta);
+			OnMoved(delta);
+		}
+
+		virtual void SaveState(TrapSnapshot& out) const
+		{
+			out.position = m_Instance.position;
+			out.collider = m_Instance.collider;
+		}
+
+		virtual void LoadState(const TrapSnapshot& state)
+		{
+			m_Instance.position = state.position;
+			m_Instance.collider = state.collider;
+		}
 
 	protected:
+		virtual void OnMoved(const EngineMath::Vector2&) {}
+
 		TrapInstance m_Instance;
+		EngineMath::Vector2 m_Origin;
 	};
 }
\ No newline at end of file
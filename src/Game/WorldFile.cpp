@@ -0,0 +1,130 @@
+#include "Game/WorldFile.h"
+#include "Core/FileSystem.h"
+#include "Core/Log.h"
+#include <cstring>
+
+namespace EngineGame
+{
+	bool WorldFile::IsCurrent(const std::string& path)
+	{
+		uint64_t worldSize, jsonSize;
+		int64_t worldTime, jsonTime;
+
+		if (!EngineCore::FileSystem::GetStamp(path + ".ttworld", worldSize, worldTime))
+			return false;
+
+		//Json saved from the editor after the last cook
+		if (EngineCore::FileSystem::GetStamp(path + ".json", jsonSize, jsonTime) && jsonTime > worldTime)
+		{
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Warning,
+				EngineCore::LogCategory::Scene,
+				"Cooked world is older than its json, loading the map : " + path
+			);
+			return false;
+		}
+
+		return true;
+	}
+
+	bool WorldFile::Open(const std::string& path)
+	{
+		m_Path = path;
+
+		//Mapped, only the chunks that are read ever get paged in
+		if (!EngineCore::FileSystem::Read(path, m_File) || m_File.GetSize() < sizeof(EngineData::WorldFileHeader))
+		{
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Error,
+				EngineCore::LogCategory::Scene,
+				"Failed to open world file: " + path
+			);
+			return false;
+		}
+
+		std::memcpy(&m_Header, m_File.GetData(), sizeof(m_Header));
+		uint64_t chunkCount = uint64_t(m_Header.chunksX) * uint64_t(m_Header.chunksY);
+
+		bool valid =
+			m_Header.magic == EngineData::WORLD_MAGIC &&
+			m_Header.version == EngineData::WORLD_VERSION &&
+			m_Header.width > 0 && m_Header.height > 0 && m_Header.tileSize > 0 && m_Header.chunkSize > 0 &&
+			m_Header.chunksX == (m_Header.width + m_Header.chunkSize - 1) / m_Header.chunkSize &&
+			m_Header.chunksY == (m_Header.height + m_Header.chunkSize - 1) / m_Header.chunkSize &&
+			m_Header.chunksOffset % alignof(EngineData::WorldFileChunk) == 0 &&
+			m_Header.chunksOffset + chunkCount * sizeof(EngineData::WorldFileChunk) <= m_File.GetSize() &&
+			m_Header.stringsOffset + m_Header.stringsSize <= m_File.GetSize() &&
+			uint64_t(m_Header.player.defOffset) + m_Header.player.defLength <= m_Header.stringsSize;
+
+		if (!valid)
+		{
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Error,
+				EngineCore::LogCategory::Scene,
+				"Invalid world file: " + path
+			);
+			return false;
+		}
+
+		m_Strings = { reinterpret_cast<const char*>(m_File.GetData() + m_Header.stringsOffset), static_cast<size_t>(m_Header.stringsSize) };
+		m_Player = { m_Header.player.x, m_Header.player.y, std::string(m_Strings.substr(m_Header.player.defOffset, m_Header.player.defLength)) };
+
+		EngineCore::Log::Write(
+			EngineCore::LogLevel::Info,
+			EngineCore::LogCategory::Scene,
+			"World opened : " + path + " (" + std::to_string(m_Header.chunksX) + "x" + std::to_string(m_Header.chunksY) + " chunks)"
+		);
+
+		return true;
+	}
+
+	bool WorldFile::ReadChunk(int chunkX, int chunkY, ChunkData& outChunk) const
+	{
+		if (chunkX < 0 || chunkX >= m_Header.chunksX || chunkY < 0 || chunkY >= m_Header.chunksY)
+			return false;
+
+		const auto* table = reinterpret_cast<const EngineData::WorldFileChunk*>(m_File.GetData() + m_Header.chunksOffset);
+		const EngineData::WorldFileChunk& entry = table[size_t(chunkY) * m_Header.chunksX + chunkX];
+
+		uint64_t cells = uint64_t(m_Header.chunkSize) * uint64_t(m_Header.chunkSize);
+		uint64_t spawnsOffset = entry.offset + EngineData::WorldChunkSpawnsOffset(m_Header.chunkSize);
+		uint64_t spawnCount = uint64_t(entry.enemyCount) + entry.interactableCount + entry.trapCount;
+
+		if (spawnsOffset % alignof(EngineData::MapFileSpawn) != 0 ||
+			spawnsOffset + spawnCount * sizeof(EngineData::MapFileSpawn) > m_File.GetSize())
+		{
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Error,
+				EngineCore::LogCategory::Scene,
+				"Corrupt chunk " + std::to_string(chunkX) + "," + std::to_string(chunkY) + " in world: " + m_Path
+			);
+			return false;
+		}
+
+		outChunk.x = chunkX;
+		outChunk.y = chunkY;
+		outChunk.tiles.assign(m_File.GetData() + entry.offset, m_File.GetData() + entry.offset + cells);
+
+		const auto* spawns = reinterpret_cast<const EngineData::MapFileSpawn*>(m_File.GetData() + spawnsOffset);
+		return ReadSpawns(spawns, entry.enemyCount, outChunk.enemies) &&
+			ReadSpawns(spawns + entry.enemyCount, entry.interactableCount, outChunk.interactables) &&
+			ReadSpawns(spawns + entry.enemyCount + entry.interactableCount, entry.trapCount, outChunk.traps);
+	}
+
+	bool WorldFile::ReadSpawns(const EngineData::MapFileSpawn* table, uint32_t count, std::vector<EngineData::SpawnData>& outSpawns) const
+	{
+		outSpawns.clear();
+		outSpawns.reserve(count);
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const EngineData::MapFileSpawn& spawn = table[i];
+			if (uint64_t(spawn.defOffset) + spawn.defLength > m_Strings.size())
+				return false;
+
+			outSpawns.push_back({ spawn.x, spawn.y, std::string(m_Strings.substr(spawn.defOffset, spawn.defLength)) });
+		}
+
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,50 @@
+#pragma once
+#include "Core/Data/Map/MapData.h"
+#include "Core/Data/Map/WorldFormat.h"
+#include "Core/FileData.h"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+
+namespace EngineGame
+{
+	//One chunk copied out of a world file, spawn positions in tiles like MapData
+	struct ChunkData
+	{
+		int x = 0;
+		int y = 0;
+		std::vector<uint8_t> tiles;		//chunkSize * chunkSize cells
+		std::vector<EngineData::SpawnData> enemies;
+		std::vector<EngineData::SpawnData> interactables;
+		std::vector<EngineData::SpawnData> traps;
+	};
+
+	//Opened .ttworld, the file stays mapped and chunks are copied out on demand.
+	//Read only after Open, any thread may call ReadChunk
+	class WorldFile
+	{
+	public:
+		//Path without extension, false when there is no .ttworld or the editor json is newer
+		static bool IsCurrent(const std::string& path);
+		bool Open(const std::string& path);
+
+		int GetWidth() const { return m_Header.width; }
+		int GetHeight() const { return m_Header.height; }
+		int GetTileSize() const { return m_Header.tileSize; }
+		int GetChunkSize() const { return m_Header.chunkSize; }
+		int GetChunksX() const { return m_Header.chunksX; }
+		int GetChunksY() const { return m_Header.chunksY; }
+		const EngineData::SpawnData& GetPlayerSpawn() const { return m_Player; }
+
+		bool ReadChunk(int chunkX, int chunkY, ChunkData& outChunk) const;
+	private:
+		bool ReadSpawns(const EngineData::MapFileSpawn* table, uint32_t count, std::vector<EngineData::SpawnData>& outSpawns) const;
+
+		EngineCore::FileData m_File;
+		EngineData::WorldFileHeader m_Header{};
+		std::string_view m_Strings;
+		EngineData::SpawnData m_Player;
+		std::string m_Path;
+	};
+}
\ No newline at end of file
@@ -1,30 +1,479 @@
 #include "AssetManager.h"
+#include "SDL3_image/SDL_image.h"
+#include "Platform/TextureCache.h"
+#include "Core/JobSystem.h"
+#include "Core/FileSystem.h"
+#include "Core/AsyncIO.h"
+#include "Core/Log.h"
+#include <filesystem>
 
 namespace EnginePlatform
 {
+	//Upload budget defaults
+	constexpr int DEFAULT_MAX_UPLOADS = 4;
+	constexpr float DEFAULT_UPLOAD_BUDGET_MS = 2.0f;
+	constexpr size_t DEFAULT_MEMORY_BUDGET = 256ull * 1024 * 1024;
+
 	SDL_Renderer* AssetManager::s_Renderer = nullptr;
-	std::unordered_map<std::string, EngineGame::Texture2D*> AssetManager::s_Textures;
+	std::unique_ptr<EngineGame::Texture2D> AssetManager::s_Placeholder;
+
+	std::vector<AssetManager::TextureSlot> AssetManager::s_Slots;
+	std::unordered_map<std::string, EngineGame::TextureHandle> AssetManager::s_Lookup;
+	int AssetManager::s_MaxUploadsPerFrame = DEFAULT_MAX_UPLOADS;
+	float AssetManager::s_UploadBudgetMs = DEFAULT_UPLOAD_BUDGET_MS;
+	std::vector<EngineGame::TextureHandle> AssetManager::s_LevelRefs;
+	size_t AssetManager::s_MemoryBudget = DEFAULT_MEMORY_BUDGET;
+	size_t AssetManager::s_ResidentBytes = 0;
+	uint64_t AssetManager::s_Frame = 0;
+
+	std::mutex AssetManager::s_QueueMutex;
+	std::deque<AssetManager::PendingLoad> AssetManager::s_VisibleQueue;
+	std::deque<AssetManager::PendingLoad> AssetManager::s_BackgroundQueue;
+	std::vector<bool> AssetManager::s_Claimed;
+	std::deque<AssetManager::DecodedSurface> AssetManager::s_Decoded;
 
 	void AssetManager::Init(SDL_Renderer* renderer)
 	{
 		s_Renderer = renderer;
+
+		//Slot 0 is reserved for INVALID_TEXTURE
+		s_Slots.clear();
+		s_Slots.emplace_back();
+		s_Slots[0].state = TextureState::Failed;
+
+		{
+			std::lock_guard<std::mutex> lock(s_QueueMutex);
+			s_Claimed.assign(1, true);
+		}
+
+		TextureCache::Init(renderer);
+		CreatePlaceholder();
+	}
+
+	EngineGame::TextureHandle AssetManager::AcquireTexture(const std::string& path, TexturePriority priority, TextureScope scope)
+	{
+		//Headless games on several threads acquire too, without a renderer they never touch the tables
+		if (!s_Renderer)
+			return EngineGame::INVALID_TEXTURE;
+
+		EngineGame::TextureHandle handle;
+
+		auto it = s_Lookup.find(path);
+		if (it != s_Lookup.end())
+		{
+			handle = it->second;
+			TextureSlot& slot = s_Slots[handle];
+
+			if (slot.state == TextureState::Evicted)
+				QueueLoad(handle, priority);
+			else if (priority == TexturePriority::Visible)
+				Prioritize(handle);
+		}
+		else
+		{
+			handle = static_cast<EngineGame::TextureHandle>(s_Slots.size());
+
+			TextureSlot& slot = s_Slots.emplace_back();
+			slot.path = path;
+			slot.texture = std::make_unique<EngineGame::Texture2D>();
+			slot.texture->SetHandle(handle);
+			s_Lookup.emplace(path, handle);
+
+			{
+				std::lock_guard<std::mutex> lock(s_QueueMutex);
+				s_Claimed.push_back(true);
+			}
+
+			QueueLoad(handle, priority);
+		}
+
+		s_Slots[handle].refCount++;
+		s_Slots[handle].lastUsedFrame = s_Frame;
+
+		if (scope == TextureScope::Level)
+			s_LevelRefs.push_back(handle);
+
+		return handle;
+	}
+
+	void AssetManager::QueueLoad(EngineGame::TextureHandle handle, TexturePriority priority)
+	{
+		TextureSlot& slot = s_Slots[handle];
+		slot.state = TextureState::Queued;
+		slot.priority = priority;
+
+		{
+			std::lock_guard<std::mutex> lock(s_QueueMutex);
+			s_Claimed[handle] = false;
+
+			auto& queue = priority == TexturePriority::Visible ? s_VisibleQueue : s_BackgroundQueue;
+			queue.push_back({ handle, slot.path });
+		}
+
+		//One decode job per request, each job picks the most urgent pending load
+		if (EngineCore::JobSystem::GetWorkerCount() > 0)
+			EngineCore::JobSystem::Submit(DecodeNext);
+		else
+			DecodeNext();
+	}
+
+	void AssetManager::ReleaseTexture(EngineGame::TextureHandle handle)
+	{
+		if (handle == EngineGame::INVALID_TEXTURE || handle >= s_Slots.size())
+			return;
+
+		//Unreferenced textures stay resident until the budget needs the space
+		TextureSlot& slot = s_Slots[handle];
+		if (slot.refCount > 0)
+			slot.refCount--;
+	}
+
+	void AssetManager::ReleaseLevelScope()
+	{
+		if (!s_Renderer)
+			return;
+
+		for (EngineGame::TextureHandle handle : s_LevelRefs)
+			ReleaseTexture(handle);
+
+		s_LevelRefs.clear();
+	}
+
+	void AssetManager::SetMemoryBudget(size_t bytes)
+	{
+		s_MemoryBudget = bytes;
+		EnforceBudget();
+	}
+
+	void AssetManager::Prioritize(EngineGame::TextureHandle handle)
+	{
+		if (handle == EngineGame::INVALID_TEXTURE || handle >= s_Slots.size())
+			return;
+
+		TextureSlot& slot = s_Slots[handle];
+		if (slot.state != TextureState::Queued || slot.priority == TexturePriority::Visible)
+			return;
+
+		slot.priority = TexturePriority::Visible;
+
+		//The background entry stays queued, whichever is popped first claims the load
+		std::lock_guard<std::mutex> lock(s_QueueMutex);
+		if (!s_Claimed[handle])
+			s_VisibleQueue.push_back({ handle, slot.path });
+	}
+
+	void AssetManager::SetUploadBudget(int maxUploads, float budgetMs)
+	{
+		s_MaxUploadsPerFrame = maxUploads;
+		s_UploadBudgetMs = budgetMs;
+	}
+
+	void AssetManager::Update()
+	{
+		s_Frame++;
+
+		Uint64 start = SDL_GetPerformanceCounter();
+		double freq = (double)SDL_GetPerformanceFrequency();
+
+		for (int uploaded = 0; uploaded < s_MaxUploadsPerFrame; uploaded++)
+		{
+			DecodedSurface decoded;
+			if (!PopDecoded(decoded))
+				break;
+
+			UploadDecoded(decoded);
+
+			double elapsedMs = (SDL_GetPerformanceCounter() - start) * 1000.0 / freq;
+			if (elapsedMs >= s_UploadBudgetMs)
+				break;
+		}
+
+		if (s_ResidentBytes > s_MemoryBudget)
+			EnforceBudget();
+	}
+
+	void AssetManager::WaitForTextures(const std::vector<EngineGame::TextureHandle>& handles)
+	{
+		//Loads no worker has picked up yet are read in one batch, decodes start as each file lands
+		std::vector<PendingLoad> claimed;
+		{
+			std::lock_guard<std::mutex> lock(s_QueueMutex);
+			for (EngineGame::TextureHandle handle : handles)
+			{
+				if (handle >= s_Claimed.size() || s_Claimed[handle])
+					continue;
+
+				s_Claimed[handle] = true;
+				claimed.push_back({ handle, s_Slots[handle].path });
+			}
+		}
+
+		EngineCore::ReadBatch batch;
+		for (const PendingLoad& load : claimed)
+		{
+			CachedSurface cached;
+			if (TextureCache::Load(load.path, cached))
+			{
+				std::lock_guard<std::mutex> lock(s_QueueMutex);
+				s_Decoded.push_back({ load.handle, cached.surface, std::move(cached.mapping) });
+				continue;
+			}
+
+			batch.Add(load.path, [load](const EngineCore::FileData& file, bool)
+			{
+				DecodeFile(load.handle, load.path, file);
+			});
+		}
+		batch.Submit();
+
+		while (true)
+		{
+			DecodedSurface decoded;
+			while (PopDecoded(decoded))
+				UploadDecoded(decoded);
+
+			bool pending = false;
+			for (EngineGame::TextureHandle handle : handles)
+			{
+				if (GetState(handle) == TextureState::Queued)
+				{
+					pending = true;
+					break;
+				}
+			}
+
+			if (!pending)
+				break;
+
+			SDL_Delay(1);
+		}
+
+		if (s_ResidentBytes > s_MemoryBudget)
+			EnforceBudget();
+	}
+
+	bool AssetManager::ReloadTexture(const std::string& path)
+	{
+		//Slot paths come from GetFile and from definitions, compare the files rather than the strings
+		bool reloaded = false;
+		for (EngineGame::TextureHandle handle = 1; handle < s_Slots.size(); handle++)
+		{
+			TextureSlot& slot = s_Slots[handle];
+			std::error_code error;
+			if (slot.state == TextureState::Queued || !std::filesystem::equivalent(slot.path, path, error))
+				continue;
+
+			//Evicted slots pick the new file up when they are acquired again
+			if (slot.state != TextureState::Evicted)
+				QueueLoad(handle, TexturePriority::Visible);
+			reloaded = true;
+		}
+
+		return reloaded;
+	}
+
+	bool AssetManager::PopDecoded(DecodedSurface& outDecoded)
+	{
+		std::lock_guard<std::mutex> lock(s_QueueMutex);
+		if (s_Decoded.empty())
+			return false;
+
+		outDecoded = std::move(s_Decoded.front());
+		s_Decoded.pop_front();
+		return true;
+	}
+
+	void AssetManager::EnforceBudget()
+	{
+		//Least recently drawn unreferenced texture goes first, referenced ones are never evicted
+		while (s_ResidentBytes > s_MemoryBudget)
+		{
+			TextureSlot* victim = nullptr;
+			for (TextureSlot& slot : s_Slots)
+			{
+				if (slot.state != TextureState::Ready || slot.refCount > 0)
+					continue;
+
+				if (!victim || slot.lastUsedFrame < victim->lastUsedFrame)
+					victim = &slot;
+			}
+
+			if (!victim)
+				return;
+
+			s_ResidentBytes -= victim->texture->GetByteSize();
+			victim->texture->Release();
+			victim->state = TextureState::Evicted;
+		}
+	}
+
+	void AssetManager::UploadDecoded(const DecodedSurface& decoded)
+	{
+		TextureSlot& slot = s_Slots[decoded.handle];
+		size_t previousBytes = slot.texture->GetByteSize();	//Non zero when a reload replaces resident pixels
+
+		if (decoded.surface && slot.texture->Upload(s_Renderer, decoded.surface))
+		{
+			slot.state = TextureState::Ready;
+			slot.lastUsedFrame = s_Frame;
+			s_ResidentBytes += slot.texture->GetByteSize() - previousBytes;
+		}
+		else if (previousBytes > 0)
+		{
+			//A reload that fails, like a half written file, keeps drawing the old pixels and stays evictable
+			slot.state = TextureState::Ready;
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Warning,
+				EngineCore::LogCategory::Renderer,
+				"Failed to reload texture, keeping the previous one : " + slot.path
+			);
+		}
+		else
+		{
+			slot.state = TextureState::Failed;
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Warning,
+				EngineCore::LogCategory::Renderer,
+				"Failed to load texture : " + slot.path
+			);
+		}
+
+		if (decoded.surface)
+			SDL_DestroySurface(decoded.surface);
+	}
+
+	void AssetManager::DecodeNext()
+	{
+		PendingLoad load;
+		{
+			std::lock_guard<std::mutex> lock(s_QueueMutex);
+			if (!PopPending(s_VisibleQueue, load) && !PopPending(s_BackgroundQueue, load))
+				return;
+		}
+
+		//Warm start, pixels are already in the renderer format inside the mapped cache file
+		CachedSurface cached;
+		if (TextureCache::Load(load.path, cached))
+		{
+			std::lock_guard<std::mutex> lock(s_QueueMutex);
+			s_Decoded.push_back({ load.handle, cached.surface, std::move(cached.mapping) });
+			return;
+		}
+
+		EngineCore::FileData file;
+		EngineCore::FileSystem::Read(load.path, file);
+		DecodeFile(load.handle, load.path, file);
 	}
 
-	EngineGame::Texture2D* AssetManager::GetTexture(const std::string& path)
+	void AssetManager::DecodeFile(EngineGame::TextureHandle handle, const std::string& path, const EngineCore::FileData& file)
 	{
-		if (s_Textures.contains(path))
-			return s_Textures[path];
+		//Decoding to a CPU surface is safe off the main thread, GPU upload is not
+		SDL_Surface* surface = nullptr;
+		if (!file.IsEmpty())
+			surface = IMG_Load_IO(SDL_IOFromConstMem(file.GetData(), file.GetSize()), true);
 
-		EngineGame::Texture2D* tex = new EngineGame::Texture2D(s_Renderer, path);
-		s_Textures[path] = tex;
-		return tex;
+		surface = TextureCache::Store(path, surface);
+
+		std::lock_guard<std::mutex> lock(s_QueueMutex);
+		s_Decoded.push_back({ handle, surface, nullptr });
+	}
+
+	bool AssetManager::PopPending(std::deque<PendingLoad>& queue, PendingLoad& outLoad)
+	{
+		while (!queue.empty())
+		{
+			PendingLoad load = std::move(queue.front());
+			queue.pop_front();
+
+			if (s_Claimed[load.handle])
+				continue;
+
+			s_Claimed[load.handle] = true;
+			outLoad = std::move(load);
+			return true;
+		}
+
+		return false;
+	}
+
+	EngineGame::Texture2D* AssetManager::GetTexture(EngineGame::TextureHandle handle)
+	{
+		if (handle == EngineGame::INVALID_TEXTURE || handle >= s_Slots.size())
+			return nullptr;
+
+		TextureSlot& slot = s_Slots[handle];
+		slot.lastUsedFrame = s_Frame;
+		return slot.texture.get();
+	}
+
+	std::vector<TextureStats> AssetManager::GetResidentStats()
+	{
+		std::vector<TextureStats> stats;
+		for (const TextureSlot& slot : s_Slots)
+		{
+			if (slot.state == TextureState::Ready)
+				stats.push_back({ slot.path, slot.texture->GetByteSize(), slot.refCount });
+		}
+
+		return stats;
+	}
+
+	TextureState AssetManager::GetState(EngineGame::TextureHandle handle)
+	{
+		if (handle >= s_Slots.size())
+			return TextureState::Failed;
+
+		return s_Slots[handle].state;
+	}
+
+	void AssetManager::CreatePlaceholder()
+	{
+		//2x2 magenta-black checker, drawn until the real texture lands
+		SDL_Surface* surface = SDL_CreateSurface(2, 2, SDL_PIXELFORMAT_RGBA32);
+		if (!surface)
+			return;
+
+		Uint32 magenta = SDL_MapSurfaceRGBA(surface, 255, 0, 255, 255);
+		Uint32 black = SDL_MapSurfaceRGBA(surface, 0, 0, 0, 255);
+		SDL_Rect cell{ 0, 0, 1, 1 };
+
+		for (int y = 0; y < 2; y++)
+		{
+			for (int x = 0; x < 2; x++)
+			{
+				cell.x = x;
+				cell.y = y;
+				SDL_FillSurfaceRect(surface, &cell, (x + y) % 2 == 0 ? magenta : black);
+			}
+		}
+
+		s_Placeholder = std::make_unique<EngineGame::Texture2D>();
+		if (s_Placeholder->Upload(s_Renderer, surface))
+			SDL_SetTextureScaleMode(s_Placeholder->Get(), SDL_SCALEMODE_NEAREST);
+
+		SDL_DestroySurface(surface);
 	}
 
 	void AssetManager::Shutdown()
 	{
-		for (auto& [_, tex] : s_Textures)
-			delete tex;
+		{
+			std::lock_guard<std::mutex> lock(s_QueueMutex);
+			for (auto& decoded : s_Decoded)
+			{
+				if (decoded.surface)
+					SDL_DestroySurface(decoded.surface);
+			}
+
+			s_Decoded.clear();
+			s_VisibleQueue.clear();
+			s_BackgroundQueue.clear();
+			s_Claimed.clear();
+		}
 
-		s_Textures.clear();
+		s_Slots.clear();
+		s_Lookup.clear();
+		s_LevelRefs.clear();
+		s_ResidentBytes = 0;
+		s_Placeholder.reset();
 	}
 }
\ No newline at end of file
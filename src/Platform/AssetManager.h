@@ -1,18 +1,123 @@
 #pragma once
 #include <string>
 #include <unordered_map>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <mutex>
 #include "Game/Texture.h"
+#include "Core/MappedFile.h"
+#include "Core/FileData.h"
 
 namespace EnginePlatform
 {
+	enum class TexturePriority
+	{
+		Background = 0,
+		Visible
+	};
+
+	enum class TextureState
+	{
+		Queued,
+		Ready,
+		Failed,
+		Evicted		//Dropped by the budget, re-queued on next acquire
+	};
+
+	enum class TextureScope
+	{
+		Level = 0,	//Released by ReleaseLevelScope
+		Manual		//Owner calls ReleaseTexture
+	};
+
+	struct TextureStats
+	{
+		std::string path;
+		size_t bytes;
+		int refCount;
+	};
+
 	class AssetManager
 	{
 	public:
 		static void Init(SDL_Renderer* renderer);
-		static EngineGame::Texture2D* GetTexture(const std::string& path);
 		static void Shutdown();
+		static bool IsActive() { return s_Renderer != nullptr; }	//False in headless processes, nothing is loaded or tracked
+
+		//Streaming
+		static EngineGame::TextureHandle AcquireTexture(const std::string& path, TexturePriority priority = TexturePriority::Background, TextureScope scope = TextureScope::Level);
+		static void Prioritize(EngineGame::TextureHandle handle);
+		static void Update();	//Main thread, uploads decoded surfaces within the frame budget
+		static void SetUploadBudget(int maxUploads, float budgetMs);
+		static void WaitForTextures(const std::vector<EngineGame::TextureHandle>& handles);	//Blocks, ignores the upload budget
+		static bool ReloadTexture(const std::string& path);	//Hot reload, the handle keeps drawing the old pixels until the new ones upload
+
+		//Residency
+		static void ReleaseTexture(EngineGame::TextureHandle handle);
+		static void ReleaseLevelScope();
+		static void SetMemoryBudget(size_t bytes);
+		static size_t GetMemoryBudget() { return s_MemoryBudget; }
+		static size_t GetResidentBytes() { return s_ResidentBytes; }
+		static std::vector<TextureStats> GetResidentStats();
+
+		//Queries
+		static EngineGame::Texture2D* GetTexture(EngineGame::TextureHandle handle);
+		static EngineGame::Texture2D* GetPlaceholder() { return s_Placeholder.get(); }
+		static TextureState GetState(EngineGame::TextureHandle handle);
 	private:
+		struct TextureSlot
+		{
+			std::string path;
+			std::unique_ptr<EngineGame::Texture2D> texture;
+			TextureState state = TextureState::Queued;
+			TexturePriority priority = TexturePriority::Background;
+			int refCount = 0;
+			uint64_t lastUsedFrame = 0;
+		};
+
+		struct PendingLoad
+		{
+			EngineGame::TextureHandle handle;
+			std::string path;
+		};
+
+		struct DecodedSurface
+		{
+			EngineGame::TextureHandle handle;
+			SDL_Surface* surface;
+			std::shared_ptr<EngineCore::MappedFile> mapping;	//Set when the pixels come from the texture cache
+		};
+
+		//Worker side
+		static void DecodeNext();
+		static void DecodeFile(EngineGame::TextureHandle handle, const std::string& path, const EngineCore::FileData& file);
+		static bool PopPending(std::deque<PendingLoad>& queue, PendingLoad& outLoad);
+
+		static void CreatePlaceholder();
+		static void UploadDecoded(const DecodedSurface& decoded);
+		static bool PopDecoded(DecodedSurface& outDecoded);
+		static void QueueLoad(EngineGame::TextureHandle handle, TexturePriority priority);
+		static void EnforceBudget();
+
 		static SDL_Renderer* s_Renderer;
-		static std::unordered_map<std::string, EngineGame::Texture2D*> s_Textures;
+		static std::unique_ptr<EngineGame::Texture2D> s_Placeholder;
+
+		//Main thread only
+		static std::vector<TextureSlot> s_Slots;
+		static std::unordered_map<std::string, EngineGame::TextureHandle> s_Lookup;
+		static int s_MaxUploadsPerFrame;
+		static float s_UploadBudgetMs;
+		static std::vector<EngineGame::TextureHandle> s_LevelRefs;
+		static size_t s_MemoryBudget;
+		static size_t s_ResidentBytes;
+		static uint64_t s_Frame;
+
+		//Shared with workers, guarded by s_QueueMutex
+		static std::mutex s_QueueMutex;
+		static std::deque<PendingLoad> s_VisibleQueue;
+		static std::deque<PendingLoad> s_BackgroundQueue;
+		static std::vector<bool> s_Claimed;
+		static std::deque<DecodedSurface> s_Decoded;
 	};
 }
\ No newline at end of file
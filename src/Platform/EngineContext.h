@@ -0,0 +1,30 @@
+#pragma once
+#include "Core/Input.h"
+#include "Platform/LevelManager.h"
+
+namespace EnginePlatform
+{
+	//Everything one game instance changes while it plays, handed to its Scene
+	//Definition libraries, the level list and the string table stay process wide and read only
+	class EngineContext
+	{
+	public:
+		//Headless instances load no textures or fonts and never render, several can run on their own threads
+		explicit EngineContext(EngineCore::InputState& input, bool headless = false)
+			: m_Input(input), m_Headless(headless) {}
+
+		EngineContext(const EngineContext&) = delete;
+		EngineContext& operator=(const EngineContext&) = delete;
+
+		EngineCore::InputState& GetInput() { return m_Input; }
+		const EngineCore::InputState& GetInput() const { return m_Input; }
+		LevelManager& GetLevels() { return m_Levels; }
+		const LevelManager& GetLevels() const { return m_Levels; }
+		bool IsHeadless() const { return m_Headless; }
+
+	private:
+		EngineCore::InputState& m_Input;
+		LevelManager m_Levels;
+		bool m_Headless;
+	};
+}
\ No newline at end of file
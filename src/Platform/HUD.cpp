@@ -19,7 +19,7 @@ namespace EnginePlatform
 	const EngineCore::Color hoverColor{ 80, 80, 80, 255 };
 
 	void HUD::Render(EngineCore::IRenderer* renderer, const EngineGame::Player& player,
-		const std::vector<std::unique_ptr<EngineGame::Enemy>>& enemies,
+		const EngineGame::LevelList<EngineGame::Enemy>& enemies,
 		const EngineGame::Camera2D& camera,
 		Scene& scene,
 		GameState state,
@@ -35,7 +35,10 @@ namespace EnginePlatform
 		case GameState::Playing:
 			RenderPlayerHP(renderer, player);
 			for (auto& e : enemies)
-				RenderEnemyHP(renderer, *e, camera);
+			{
+				if (!e->IsDead())
+					RenderEnemyHP(renderer, *e, camera);
+			}
 			m_CanRenderCursor = false;
 			break;
 
@@ -80,7 +83,7 @@ namespace EnginePlatform
 	{
 		if (renderer->DrawUIButton("Restart Game", topBtn, normalColor, hoverColor).clicked)
 		{
-			scene.StartGame();
+			scene.RestartLevel();
 		}
 
 		if (renderer->DrawUIButton("Main Menu", bottomBtn, normalColor, hoverColor).clicked)
@@ -5,6 +5,7 @@
 #include "Platform/GameState.h"
 #include "Game/Player.h"
 #include "Game/Enemy.h"
+#include "Game/LevelArena.h"
 #include "Game/Camera.h"
 
 namespace EnginePlatform
@@ -15,7 +16,7 @@ namespace EnginePlatform
 	{
 	public:
 		void Render(EngineCore::IRenderer* renderer, const EngineGame::Player& player, 
-			const std::vector<std::unique_ptr<EngineGame::Enemy>>& enemies,
+			const EngineGame::LevelList<EngineGame::Enemy>& enemies,
 			const EngineGame::Camera2D& camera,
 			Scene& scene,
 			GameState state,
@@ -0,0 +1,90 @@
+#include "Platform/HotReload.h"
+#include "Platform/LibraryManager.h"
+#include "Platform/AssetManager.h"
+#include "Core/FileWatcher.h"
+#include "Core/FileSystem.h"
+#include "Core/PathUtil.h"
+#include "Core/Log.h"
+#include <filesystem>
+
+namespace EnginePlatform
+{
+	void HotReload::Init()
+	{
+		if (!EngineCore::FileWatcher::Init(EngineCore::GetAssetDirectory()))
+		{
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Info,
+				EngineCore::LogCategory::Core,
+				"Hot reload disabled, no loose asset folder to watch"
+			);
+			return;
+		}
+
+		EngineCore::Log::Write(
+			EngineCore::LogLevel::Info,
+			EngineCore::LogCategory::Core,
+			"Hot reload watching : " + EngineCore::GetAssetDirectory()
+		);
+	}
+
+	void HotReload::Shutdown()
+	{
+		EngineCore::FileWatcher::Shutdown();
+	}
+
+	bool HotReload::Poll(ReloadSet& outReloaded)
+	{
+		outReloaded = {};
+		if (!EngineCore::FileWatcher::IsActive())
+			return false;
+
+		std::vector<std::string> changed;
+		EngineCore::FileWatcher::Poll(changed);
+
+		for (const auto& path : changed)
+			ReloadFile(path, outReloaded);
+
+		return !outReloaded.IsEmpty();
+	}
+
+	void HotReload::ReloadFile(const std::string& path, ReloadSet& outReloaded)
+	{
+		//Mounted pack entries win over loose files, an edit there would never be read
+		if (EngineCore::FileSystem::IsPacked(path))
+			return;
+
+		std::filesystem::path relative = std::filesystem::path(path).lexically_relative(EngineCore::GetAssetDirectory());
+		std::string folder = relative.begin() != relative.end() ? relative.begin()->string() : "";
+		std::string name = relative.filename().string();
+		std::string extension = relative.extension().string();
+
+		bool reloaded = false;
+		if (extension == ".png")
+			reloaded = AssetManager::ReloadTexture(path);
+		else if (extension != ".json")
+			return;
+		else if (folder == "Animation")
+			reloaded = AnimationLibrary::ReloadFile(path, outReloaded.animations);
+		else if (folder == "Data" && name == "entity_def.json")
+			reloaded = EntityLibrary::ReloadFile(path, outReloaded.entities);
+		else if (folder == "Data" && name == "Interactables.json")
+			reloaded = InteractableLibrary::ReloadFile(path, outReloaded.interactables);
+		else if (folder == "Data" && name == "TrapDef.json")
+			reloaded = TrapLibrary::ReloadFile(path, outReloaded.traps);
+		else if (folder == "Maps" && !name.ends_with(".deps.json"))
+		{
+			outReloaded.maps.push_back(path);
+			reloaded = true;
+		}
+
+		if (reloaded)
+		{
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Info,
+				EngineCore::LogCategory::Core,
+				"Hot reloaded : " + relative.string()
+			);
+		}
+	}
+}
\ No newline at end of file
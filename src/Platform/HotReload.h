@@ -0,0 +1,35 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "Core/StringId.h"
+
+namespace EnginePlatform
+{
+	//What one poll patched, the scene rebuilds whatever still points at it
+	struct ReloadSet
+	{
+		std::vector<EngineCore::StringId> animations;
+		std::vector<EngineCore::StringId> entities;
+		std::vector<EngineCore::StringId> interactables;
+		std::vector<EngineCore::StringId> traps;
+		std::vector<std::string> maps;		//Map json paths as written
+
+		bool IsEmpty() const
+		{
+			return animations.empty() && entities.empty() && interactables.empty() && traps.empty() && maps.empty();
+		}
+	};
+
+	//Watches Assets while the game runs, edited definitions and textures are patched in place between frames
+	class HotReload
+	{
+	public:
+		static void Init();
+		static void Shutdown();
+
+		//Main thread between frames, false when nothing the scene uses changed
+		static bool Poll(ReloadSet& outReloaded);
+	private:
+		static void ReloadFile(const std::string& path, ReloadSet& outReloaded);
+	};
+}
\ No newline at end of file
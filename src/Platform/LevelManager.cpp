@@ -1,47 +1,39 @@
 #include "Platform/LevelManager.h"
 #include "Core/JsonLoader.h"
 #include "Core/Data/Level/LevelParser.h"
+#include "Core/Data/JsonRecordReader.h"
 #include "Core/Log.h"
 
 namespace EnginePlatform
 {
-	LevelManager& LevelManager::Get()
-	{
-		static LevelManager instance;
-		return instance;
-	}
-
 	bool LevelManager::LoadAllLevels(const std::string& filePath)
 	{
-		m_Levels.clear();
-		m_CurrentLevelIndex = -1;
+		s_Levels.clear();
 
-		nlohmann::json j;
+		EngineData::DataArena arena;
+		std::vector<EngineData::LevelData> levels;
+		EngineData::JsonRecordReader<EngineData::LevelData, EngineData::LevelParser> reader(levels, arena, "Levels");
 
-		if (!EngineCore::JsonLoader::LoadFromFile(filePath, j))
+		if (!EngineCore::JsonLoader::Parse(filePath, reader))
 		{
 			EngineCore::Log::Write(
 				EngineCore::LogLevel::Error,
 				EngineCore::LogCategory::Core,
-				"Levels loaded succesfully : " + std::to_string(m_Levels.size())
+				"Failed to parse level file"
 			);
 			return false;
 		}
 
-		if (!EngineData::LevelParser::Parse(j, m_Levels))
+		for (auto& level : levels)
 		{
-			EngineCore::Log::Write(
-				EngineCore::LogLevel::Error,
-				EngineCore::LogCategory::Core,
-				"Failed to parse level file"
-			);
-			return false;
+			if (level.IsActive)
+				s_Levels.push_back(std::move(level));
 		}
 
 		EngineCore::Log::Write(
 			EngineCore::LogLevel::Info,
 			EngineCore::LogCategory::Core,
-			"Levels loaded succesfully : " + std::to_string(m_Levels.size())
+			"Levels loaded succesfully : " + std::to_string(s_Levels.size())
 		);
 
 		return true;
@@ -49,15 +41,15 @@ namespace EnginePlatform
 
 	const EngineData::LevelData* LevelManager::GetCurrentLevel() const
 	{
-		if (m_CurrentLevelIndex < 0 || m_CurrentLevelIndex >= (int)m_Levels.size())
+		if (m_CurrentLevelIndex < 0 || m_CurrentLevelIndex >= (int)s_Levels.size())
 			return nullptr;
 
-		return &m_Levels[m_CurrentLevelIndex];
+		return &s_Levels[m_CurrentLevelIndex];
 	}
 
 	void LevelManager::StartLevelByIndex(int index)
 	{
-		if(index < 0 || index >= (int)m_Levels.size())
+		if(index < 0 || index >= (int)s_Levels.size())
 			return;
 
 		m_CurrentLevelIndex = index;
@@ -72,7 +64,7 @@ namespace EnginePlatform
 	void LevelManager::LoadNextLevel()
 	{
 		int next = m_CurrentLevelIndex + 1;
-		if (next < (int)m_Levels.size())
+		if (next < (int)s_Levels.size())
 			StartLevelByIndex(next);
 		else
 			CompleteAll();
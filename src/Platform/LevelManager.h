@@ -5,25 +5,22 @@
 
 namespace EnginePlatform
 {
+	//Progress through the level list, one per game instance, the list itself is loaded once and shared
 	class LevelManager
 	{
 	public:
-		static LevelManager& Get();
-
-		bool LoadAllLevels(const std::string& filePath);
+		static bool LoadAllLevels(const std::string& filePath);	//Before any instance starts a level
+		static const std::vector<EngineData::LevelData>& GetLevels() { return s_Levels; }
 
 		void StartLevelByIndex(int index);
 		void LoadNextLevel();
 		void CompleteAll();
 
 		const EngineData::LevelData* GetCurrentLevel() const;
-		const std::vector<EngineData::LevelData>& GetLevels() const { return m_Levels; }
 		int GetCurrentIndex() const { return m_CurrentLevelIndex; }
 
 	private:
-		LevelManager() = default;
-
-		std::vector<EngineData::LevelData> m_Levels;
+		static inline std::vector<EngineData::LevelData> s_Levels;
 		int m_CurrentLevelIndex = -1;
 	};
 }
\ No newline at end of file
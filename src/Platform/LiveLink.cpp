@@ -0,0 +1,121 @@
+#include "Platform/LiveLink.h"
+#include "Platform/LibraryManager.h"
+#include "Core/LiveLinkServer.h"
+#include "Core/FileWatcher.h"
+#include "Core/Log.h"
+
+namespace EnginePlatform
+{
+	void LiveLink::Init()
+	{
+		//Same rule as hot reload, a packed build has no editor to talk to
+		if (!EngineCore::FileWatcher::IsActive() || !EngineCore::LiveLinkServer::Start(EngineCore::LIVELINK_PORT))
+			return;
+
+		EngineCore::Log::Write(
+			EngineCore::LogLevel::Info,
+			EngineCore::LogCategory::Core,
+			"Live link listening on port " + std::to_string(EngineCore::LIVELINK_PORT)
+		);
+	}
+
+	void LiveLink::Shutdown()
+	{
+		EngineCore::LiveLinkServer::Stop();
+	}
+
+	bool LiveLink::Poll(LiveEdits& outEdits)
+	{
+		outEdits = {};
+		if (!EngineCore::LiveLinkServer::IsActive())
+			return false;
+
+		std::vector<EngineCore::LiveLinkPacket> packets;
+		EngineCore::LiveLinkServer::Poll(packets);
+
+		for (const auto& packet : packets)
+		{
+			EngineCore::LiveLinkReader reader(packet.payload.data(), packet.payload.size());
+
+			bool read = false;
+			if (packet.type == EngineCore::LiveLinkMessage::Definition)
+				read = ReadDefinition(reader, outEdits);
+			else
+				read = ReadMapEdit(packet.type, reader, outEdits);
+
+			if (!read)
+			{
+				EngineCore::Log::Write(
+					EngineCore::LogLevel::Warning,
+					EngineCore::LogCategory::Core,
+					"Live link message " + std::to_string((int)packet.type) + " is malformed, skipped"
+				);
+			}
+		}
+
+		return !outEdits.IsEmpty();
+	}
+
+	bool LiveLink::ReadMapEdit(EngineCore::LiveLinkMessage type, EngineCore::LiveLinkReader& reader, LiveEdits& outEdits)
+	{
+		std::string_view mapId;
+		if (!reader.ReadString(mapId))
+			return false;
+
+		LiveMapEdit edit;
+		edit.mapId = mapId;
+
+		if (type == EngineCore::LiveLinkMessage::Tiles)
+		{
+			uint32_t count = 0;
+			if (!reader.Read(count) || reader.Remaining() / (sizeof(uint32_t) * 2) < count)
+				return false;
+
+			edit.tiles.reserve(count);
+			for (uint32_t i = 0; i < count; i++)
+			{
+				uint32_t index = 0;
+				uint32_t value = 0;
+				reader.Read(index);
+				reader.Read(value);
+				if (value > UINT8_MAX)		//Same range the map parser takes for the collision layer
+					return false;
+
+				edit.tiles.push_back({ index, EngineGame::TileType(value) });
+			}
+		}
+		else if (type == EngineCore::LiveLinkMessage::MoveSpawn)
+		{
+			LiveSpawnMove move;
+			if (!reader.Read(move.kind) || !reader.Read(move.from.x) || !reader.Read(move.from.y) ||
+				!reader.Read(move.to.x) || !reader.Read(move.to.y) || move.kind > EngineCore::LiveSpawnKind::Trap)
+				return false;
+
+			edit.spawns.push_back(move);
+		}
+		else
+			return false;
+
+		outEdits.maps.push_back(std::move(edit));
+		return reader.IsOk();
+	}
+
+	bool LiveLink::ReadDefinition(EngineCore::LiveLinkReader& reader, LiveEdits& outEdits)
+	{
+		EngineCore::LiveDefinitionKind kind;
+		if (!reader.Read(kind))
+			return false;
+
+		ReloadSet& reloaded = outEdits.definitions;
+		switch (kind)
+		{
+		case EngineCore::LiveDefinitionKind::Entity:
+			return EntityLibrary::ReloadText(reader.Rest(), "live link", reloaded.entities);
+		case EngineCore::LiveDefinitionKind::Interactable:
+			return InteractableLibrary::ReloadText(reader.Rest(), "live link", reloaded.interactables);
+		case EngineCore::LiveDefinitionKind::Trap:
+			return TrapLibrary::ReloadText(reader.Rest(), "live link", reloaded.traps);
+		}
+		return false;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "Core/LiveLinkFormat.h"
+#include "Core/Math/Vector2.h"
+#include "Game/TileMap.h"
+#include "Platform/HotReload.h"
+
+namespace EnginePlatform
+{
+	struct LiveTile
+	{
+		uint32_t index;		//y * width + x
+		EngineGame::TileType type;
+	};
+
+	struct LiveSpawnMove
+	{
+		EngineCore::LiveSpawnKind kind;
+		EngineMath::Vector2 from;	//Tiles
+		EngineMath::Vector2 to;
+	};
+
+	//One map message, only applied while that map is the level being played
+	struct LiveMapEdit
+	{
+		std::string mapId;
+		std::vector<LiveTile> tiles;
+		std::vector<LiveSpawnMove> spawns;
+	};
+
+	struct LiveEdits
+	{
+		std::vector<LiveMapEdit> maps;
+		ReloadSet definitions;		//Patched in the libraries already, like a hot reload
+
+		bool IsEmpty() const { return maps.empty() && definitions.IsEmpty(); }
+	};
+
+	//Edits the editor sends while the game runs, each one touches only the cells and records it names
+	class LiveLink
+	{
+	public:
+		static void Init();
+		static void Shutdown();
+
+		//Main thread between frames, false when nothing arrived
+		static bool Poll(LiveEdits& outEdits);
+	private:
+		static bool ReadMapEdit(EngineCore::LiveLinkMessage type, EngineCore::LiveLinkReader& reader, LiveEdits& outEdits);
+		static bool ReadDefinition(EngineCore::LiveLinkReader& reader, LiveEdits& outEdits);
+	};
+}
\ No newline at end of file
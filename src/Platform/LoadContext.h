@@ -1,6 +1,7 @@
 #pragma once
 #include <vector>
 #include <memory>
+#include "Game/LevelArena.h"
 
 namespace EngineGame
 {
@@ -19,11 +20,18 @@ namespace EngineData
 
 namespace EnginePlatform
 {
+	class WorldStreamer;
+	class EngineContext;
+
 	struct LoadContext
 	{
+		//Instance the level loads into
+		EngineContext& engine;
+		EngineGame::LevelArena& levelArena;		//Everything below the player is built in it
+
 		//Entity
 		EngineGame::Player& player;
-		std::vector<std::unique_ptr<EngineGame::Enemy>>& enemies;
+		EngineGame::LevelList<EngineGame::Enemy>& enemies;
 
 		//Map
 		std::unique_ptr<EngineGame::TileMap>& tileMap;
@@ -36,22 +44,30 @@ namespace EnginePlatform
 		//Camera
 		EngineGame::Camera2D& camera;
 
+		//Streamed worlds
+		WorldStreamer& world;
+
 		//Other Variables
 		bool& playerSpawned;
 		bool& levelCompleted;
 
 		LoadContext(
+			EngineContext& eng,
+			EngineGame::LevelArena& arena,
 			EngineGame::Player& p,
-			std::vector<std::unique_ptr<EngineGame::Enemy>>& e,
+			EngineGame::LevelList<EngineGame::Enemy>& e,
 			std::unique_ptr<EngineGame::TileMap>& t,
 			EngineData::MapData& m,
 			EngineGame::InteractableManager& i,
 			EngineGame::TrapManager& trap,
 			EngineGame::Camera2D& c,
+			WorldStreamer& w,
 			bool& pSpawn,
 			bool& lC
 		) 
 			:
+			engine(eng),
+			levelArena(arena),
 			player(p),
 			enemies(e),
 			tileMap(t),
@@ -59,6 +75,7 @@ namespace EnginePlatform
 			interactableList(i),
 			trapList(trap),
 			camera(c),
+			world(w),
 			playerSpawned(pSpawn),
 			levelCompleted(lC)
 		{}
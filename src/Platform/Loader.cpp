@@ -1,29 +1,76 @@
 #include "Platform/Loader.h"
 #include "Platform/LibraryManager.h"
 #include "Core/PathUtil.h"
-#include "Platform/LevelManager.h"
+#include "Platform/EngineContext.h"
 #include "Core/Log.h"
 #include "Core/Data/Level/LevelData.h"
 #include "Platform/Scene.h"
+#include "Platform/WorldStreamer.h"
+#include "Platform/AssetManager.h"
+#include "Platform/RendererSdl.h"
+#include "Core/Data/Level/LevelManifest.h"
+#include "Core/Data/Level/LevelManifestParser.h"
+#include "Core/Data/JsonRecordReader.h"
+#include "Core/FileSystem.h"
+#include "Core/AsyncIO.h"
+#include "Core/JobSystem.h"
+#include <filesystem>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <algorithm>
 
 namespace EnginePlatform
 {
+	static void AddUnique(std::vector<std::string>& list, std::string_view value)
+	{
+		if (!value.empty() && std::find(list.begin(), list.end(), value) == list.end())
+			list.emplace_back(value);
+	}
+
+	//Cooked manifests store paths relative to Assets
+	static std::string ResolveAsset(const std::string& relative)
+	{
+		std::filesystem::path path(relative);
+		return EngineCore::GetFile(path.parent_path().string(), path.filename().string());
+	}
+
+	static std::string GetAnimationFolder()
+	{
+		return (std::filesystem::path(EngineCore::GetAssetDirectory()) / "Animation").string();
+	}
+
 	void Loader::LoadBasics()
 	{
-		//Animation Library loaded
-		std::string animDir = EngineCore::GetExecutableDirectory() + "\\Assets\\Animation";
-		if (!AnimationLibrary::LoadFromFolder(animDir))
+		//Cooked definitions replace every json below when they are current
+		if (LoadDefinitionBlob())
 		{
 			EngineCore::Log::Write(
-				EngineCore::LogLevel::Fatal,
+				EngineCore::LogLevel::Info,
 				EngineCore::LogCategory::Scene,
-				"Failed to load all animation files"
+				"Scene basics have been loaded from cooked definitions"
 			);
 			return;
 		}
 
+		//Every definition file is read in one batch, each parses as soon as its bytes land
+		Uint64 start = SDL_GetPerformanceCounter();
+
+		EngineCore::ReadBatch batch;
+		AnimationLibrary::QueueFolder(GetAnimationFolder(), batch);
+		EntityLibrary::QueueFile(EngineCore::GetFile("Data", "entity_def.json"), batch);
+		InteractableLibrary::QueueFile(EngineCore::GetFile("Data", "Interactables.json"), batch);
+		TrapLibrary::QueueFile(EngineCore::GetFile("Data", "TrapDef.json"), batch);
+		batch.Wait();
+
+		//A broken animation file only loses that animation
+		AnimationLibrary::Merge();
+		bool entitiesLoaded = EntityLibrary::Merge();
+		InteractableLibrary::Merge();
+		TrapLibrary::Merge();
+
 		//Entity Definitions loaded
-		if (!EntityLibrary::LoadFromFile(EngineCore::GetFile("Data", "entity_def.json")))
+		if (!entitiesLoaded)
 		{
 			EngineCore::Log::Write(
 				EngineCore::LogLevel::Fatal,
@@ -33,9 +80,12 @@ namespace EnginePlatform
 			return;
 		}
 
-		//Interactable + Trap Definitions Loaded
-		InteractableLibrary::LoadFromFile(EngineCore::GetFile("Data", "Interactables.json"));
-		TrapLibrary::LoadFromFile(EngineCore::GetFile("Data", "TrapDef.json"));
+		double elapsedMs = (SDL_GetPerformanceCounter() - start) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+		EngineCore::Log::Write(
+			EngineCore::LogLevel::Info,
+			EngineCore::LogCategory::Scene,
+			"Definition libraries parsed in " + std::to_string(elapsedMs) + " ms"
+		);
 
 		EngineCore::Log::Write(
 			EngineCore::LogLevel::Info,
@@ -44,9 +94,82 @@ namespace EnginePlatform
 		);
 	}
 
+	bool Loader::LoadDefinitionBlob()
+	{
+		std::string blobPath = EngineCore::GetFile("Data", EngineData::DEFINITIONS_FILE);
+
+		uint64_t size;
+		int64_t blobTime;
+		if (!EngineCore::FileSystem::GetStamp(blobPath, size, blobTime))
+			return false;
+
+		//Any json edited after the cook means the blob is stale
+		std::vector<std::string> sources = EngineCore::FileSystem::List(GetAnimationFolder(), ".json");
+		sources.push_back(EngineCore::GetFile("Data", "entity_def.json"));
+		sources.push_back(EngineCore::GetFile("Data", "Interactables.json"));
+		sources.push_back(EngineCore::GetFile("Data", "TrapDef.json"));
+
+		for (const auto& source : sources)
+		{
+			int64_t sourceTime;
+			if (EngineCore::FileSystem::GetStamp(source, size, sourceTime) && sourceTime > blobTime)
+			{
+				EngineCore::Log::Write(
+					EngineCore::LogLevel::Warning,
+					EngineCore::LogCategory::Scene,
+					"Cooked definitions are older than " + source + ", loading json"
+				);
+				return false;
+			}
+		}
+
+		EngineCore::FileData data;
+		EngineData::DefinitionBlob blob;
+		if (!EngineCore::FileSystem::Read(blobPath, data) || !blob.Open(std::move(data)))
+		{
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Warning,
+				EngineCore::LogCategory::Scene,
+				"Invalid definition blob, loading json : " + blobPath
+			);
+			return false;
+		}
+
+		AnimationLibrary::Clear();
+		EntityLibrary::Clear();
+		InteractableLibrary::Clear();
+		TrapLibrary::Clear();
+
+		AnimationLibrary::LoadFromBlob(blob);
+		EntityLibrary::LoadFromBlob(blob);
+		InteractableLibrary::LoadFromBlob(blob);
+		TrapLibrary::LoadFromBlob(blob);
+
+		return true;
+	}
+
+	//Map, the tile grid and the manifest, everything a level needs that does not touch the renderer
+	struct PreparedLevel
+	{
+		std::string mapId;
+		EngineData::MapData mapData;
+		EngineData::LevelManifest manifest;
+		bool mapLoaded = false;
+		bool manifestLoaded = false;
+		std::unique_ptr<EngineGame::TileMap> tileMap;
+		std::shared_ptr<EngineGame::WorldFile> world;	//Cooked world, streamed instead of spawned at once
+
+		std::atomic<bool> started = false;	//Claimed by whoever reads it, the worker or a load that cannot wait
+		std::atomic<bool> read = false;		//Set once the fields above are filled
+		std::mutex mutex;
+		std::condition_variable readDone;
+		bool queued = false;				//Manifest resolved and textures acquired, main thread
+		std::vector<EngineGame::TextureHandle> textures;	//Manual refs held until the swap
+	};
+
 	void Loader::LoadCurrentLevel(LoadContext& ctx)
 	{
-		const EngineData::LevelData* level = LevelManager::Get().GetCurrentLevel();
+		const EngineData::LevelData* level = ctx.engine.GetLevels().GetCurrentLevel();
 	
 		if (!level)
 		{
@@ -58,39 +181,209 @@ namespace EnginePlatform
 			return;
 		}
 
-		LoadMap(ctx, level->mapId);
+		std::shared_ptr<PreparedLevel> prepared = std::move(m_Prepared);
+		if (prepared && prepared->mapId == level->mapId)
+		{
+			//Normally finished during the fade, a job still queued behind other work is read here instead
+			if (!prepared->started.exchange(true, std::memory_order_acq_rel))
+			{
+				ReadLevel(prepared->mapId, *prepared);
+				prepared->read.store(true, std::memory_order_release);
+			}
+			else
+			{
+				std::unique_lock<std::mutex> lock(prepared->mutex);
+				prepared->readDone.wait(lock, [&prepared]() { return prepared->read.load(std::memory_order_acquire); });
+			}
+		}
+		else
+		{
+			if (prepared)
+			{
+				//Prepared for another level, the worker may still hold it so only the refs are dropped
+				prepared->started.store(true, std::memory_order_release);
+				for (EngineGame::TextureHandle handle : prepared->textures)
+					AssetManager::ReleaseTexture(handle);
+			}
+
+			prepared = std::make_shared<PreparedLevel>();
+			prepared->mapId = level->mapId;
+			ReadLevel(level->mapId, *prepared);
+		}
+
+		ActivateLevel(ctx, *prepared);
+	}
+
+	void Loader::PrepareLevel(const std::string& mapId)
+	{
+		if (m_Prepared && m_Prepared->mapId == mapId)
+			return;
+
+		if (m_Prepared)
+		{
+			m_Prepared->started.store(true, std::memory_order_release);
+			for (EngineGame::TextureHandle handle : m_Prepared->textures)
+				AssetManager::ReleaseTexture(handle);
+		}
+
+		m_Prepared = std::make_shared<PreparedLevel>();
+		m_Prepared->mapId = mapId;
+
+		std::shared_ptr<PreparedLevel> prepared = m_Prepared;
+		auto job = [prepared]()
+		{
+			//Already read by the load or abandoned
+			if (prepared->started.exchange(true, std::memory_order_acq_rel))
+				return;
+
+			ReadLevel(prepared->mapId, *prepared);
+			{
+				std::lock_guard<std::mutex> lock(prepared->mutex);
+				prepared->read.store(true, std::memory_order_release);
+			}
+			prepared->readDone.notify_all();
+		};
+
+		if (EngineCore::JobSystem::GetWorkerCount() > 0)
+			EngineCore::JobSystem::Submit(job);
+		else
+			job();
+	}
+
+	void Loader::UpdatePrepare()
+	{
+		if (!m_Prepared || m_Prepared->queued || !m_Prepared->read.load(std::memory_order_acquire))
+			return;
+
+		//Decodes run on the workers, AssetManager::Update uploads them within its frame budget
+		PreparedLevel& level = *m_Prepared;
+		level.queued = true;
+		if (!level.mapLoaded)
+			return;
+
+		BuildManifest(level.mapData, level.manifestLoaded, level.manifest);
+		for (const auto& texture : level.manifest.textures)
+			level.textures.push_back(AssetManager::AcquireTexture(texture, TexturePriority::Background, TextureScope::Manual));
+
+		for (const auto& font : level.manifest.fonts)
+			RendererSdl::LoadFont(font);
 	}
 
 	//Map
-	void Loader::LoadMap(LoadContext& ctx, const std::string& mapId)
+	bool Loader::ReadLevel(const std::string& mapId, PreparedLevel& outLevel)
 	{
-		ctx.enemies.clear();
+		std::string mapBase = EngineCore::GetFile("Maps", mapId);
+		std::string manifestPath = EngineCore::GetFile("Maps", std::filesystem::path(mapId).stem().string() + ".deps.json");
+
+		//A current cooked world is streamed, only its header is read here
+		bool streamed = EngineGame::WorldFile::IsCurrent(mapBase);
+		std::string mapPath = streamed ? mapBase + ".ttworld" : EngineGame::MapLoader::GetSourcePath(mapBase);
+
+		//Map and cooked manifest are read together, each parses as soon as it lands
+		EngineCore::ReadBatch batch;
+		if (!streamed)
+		{
+			batch.Add(mapPath, [&](const EngineCore::FileData& file, bool ok)
+			{
+				outLevel.mapLoaded = ok && EngineGame::MapLoader::LoadFromData(mapPath, file, outLevel.mapData);
+			});
+		}
+
+		if (EngineCore::FileSystem::Exists(manifestPath))
+		{
+			batch.Add(manifestPath, [&](const EngineCore::FileData& file, bool ok)
+			{
+				EngineData::DataArena arena;
+				std::vector<EngineData::LevelManifest> manifests;
+				EngineData::JsonRecordReader<EngineData::LevelManifest, EngineData::LevelManifestParser> reader(manifests, arena);
+
+				outLevel.manifestLoaded = ok && EngineCore::JsonLoader::Parse(manifestPath, file, reader) && manifests.size() == 1;
+				if (outLevel.manifestLoaded)
+					outLevel.manifest = std::move(manifests.front());
+			});
+		}
+
+		batch.Wait();
+
+		if (streamed)
+		{
+			auto world = std::make_shared<EngineGame::WorldFile>();
+			outLevel.mapLoaded = world->Open(mapPath);
+			if (outLevel.mapLoaded)
+			{
+				//The player is the only spawn placed up front
+				outLevel.mapData.w = world->GetWidth();
+				outLevel.mapData.h = world->GetHeight();
+				outLevel.mapData.tSize = world->GetTileSize();
+				outLevel.mapData.spawns = { world->GetPlayerSpawn() };
+				outLevel.world = std::move(world);
+			}
+		}
+
+		if (!outLevel.mapLoaded)
+		{
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Error,
+				EngineCore::LogCategory::Scene,
+				"Failed to load map file: " + mapPath
+			);
+			return false;
+		}
+
+		//TileMap Creation, textures are resolved on the main thread
+		const EngineData::MapData& map = outLevel.mapData;
+		if (outLevel.world)
+		{
+			outLevel.tileMap = std::make_unique<EngineGame::TileMap>(map.w, map.h, map.tSize, outLevel.world->GetChunkSize());
+			return true;
+		}
+
+		outLevel.tileMap = std::make_unique<EngineGame::TileMap>(map.w, map.h, map.tSize);
+		outLevel.tileMap->SetTiles(map.tiles.GetData(), map.tiles.GetSize());
+		return true;
+	}
+
+	void Loader::ActivateLevel(LoadContext& ctx, PreparedLevel& level)
+	{
+		//Previous level's textures become evictable, shared ones are re-acquired below
+		ctx.world.Close();
+		AssetManager::ReleaseLevelScope();
+
+		//Every object of the last level is destroyed first, then its memory goes in one reset
+		EngineGame::ReleaseList(ctx.enemies);
+		ctx.interactableList.Clear();
+		ctx.trapList.Clear();
+		ctx.levelArena.Reset();
+
 		ctx.levelCompleted = false;
 		ctx.playerSpawned = false;
 		ctx.player.Reset();
 
-		std::string targetPath = EngineCore::GetFile("Maps", mapId);
-
-		//Loading Map
-		if (!EngineGame::MapLoader::LoadFromFile(targetPath, ctx.mapData))
+		if (!level.mapLoaded)
 			return;
 
-		//TileMap Creation
-		ctx.tileMap = std::make_unique<EngineGame::TileMap>(ctx.mapData.w, ctx.mapData.h, ctx.mapData.tSize);
-
-		std::vector<EngineGame::TileType> tiles;
-		tiles.reserve(ctx.mapData.tiles.size());
+		//Everything the level needs is resident before the first frame is drawn, prepared textures already are
+		if (!ctx.engine.IsHeadless())
+		{
+			if (!level.queued)
+				BuildManifest(level.mapData, level.manifestLoaded, level.manifest);
+			Prewarm(level.manifest);
+		}
 
-		for (int v : ctx.mapData.tiles)
-			tiles.push_back(static_cast<EngineGame::TileType>(v));
+		for (EngineGame::TextureHandle handle : level.textures)
+			AssetManager::ReleaseTexture(handle);
+		level.textures.clear();
 
-		ctx.tileMap->SetTiles(tiles);
+		ctx.mapData = std::move(level.mapData);
+		ctx.tileMap = std::move(level.tileMap);
 		ctx.tileMap->LoadAssets();
 
-		//Other Load Operations
+		//Other Load Operations, a streamed world spawns the rest chunk by chunk around the player
 		LoadSpawnEntities(ctx);
 		LoadInteractables(ctx);
 		LoadTraps(ctx);
+		if (level.world)
+			ctx.world.Begin(std::move(level.world), ctx);
 		LoadCamera(ctx);
 
 		EngineCore::Log::Write(
@@ -98,6 +391,104 @@ namespace EnginePlatform
 			EngineCore::LogCategory::Scene,
 			"Map Loaded + TileMap initialized + Player-Enemies have been spawned + Interactables-Traps spawned + Camera loaded."
 		);
+
+		EngineCore::Log::Write(
+			EngineCore::LogLevel::Trace,
+			EngineCore::LogCategory::Scene,
+			"Level arena : " + std::to_string(ctx.levelArena.GetReservedBytes() / 1024) + " KB"
+		);
+	}
+
+	//Manifest
+	void Loader::BuildManifest(const EngineData::MapData& map, bool cooked, EngineData::LevelManifest& manifest)
+	{
+		if (cooked)
+		{
+			for (auto& texture : manifest.textures)
+				texture = ResolveAsset(texture);
+			for (auto& font : manifest.fonts)
+				font = ResolveAsset(font);
+		}
+		else
+		{
+			manifest = {};
+
+			//No cooked manifest, walk the map the same way the spawn functions do
+			for (const auto& spawn : map.spawns)
+			{
+				const EngineData::EntityData* def = EntityLibrary::Get(spawn.defId);
+				if (!def)
+					continue;
+
+				AddUnique(manifest.animations, def->idleAnim);
+				AddUnique(manifest.animations, def->walkAnim);
+				AddUnique(manifest.animations, def->hurtAnim);
+				AddUnique(manifest.animations, def->deathAnim);
+				for (const auto& anim : def->attackAnims)
+					AddUnique(manifest.animations, anim);
+			}
+
+			AddUnique(manifest.textures, EngineCore::GetFile("Textures", EngineGame::TileMap::GROUND_TEXTURE));
+			AddUnique(manifest.textures, EngineCore::GetFile("Textures", EngineGame::TileMap::WALL_TEXTURE));
+
+			for (const auto& s : map.interactables)
+			{
+				if (const EngineData::InteractableData* def = InteractableLibrary::Get(s.defId))
+					AddUnique(manifest.textures, EngineCore::GetFile("Textures", def->imagePath));
+			}
+
+			for (const auto& s : map.traps)
+			{
+				if (const EngineData::TrapData* def = TrapLibrary::Get(s.defId))
+					AddUnique(manifest.textures, EngineCore::GetFile("Textures", def->imagePath));
+			}
+
+			AddUnique(manifest.fonts, EngineCore::GetFile("Fonts", RendererSdl::UI_FONT_FILE));
+		}
+
+		//Sprite sheets always come from the animation library so they match Animator::Create
+		for (const auto& id : manifest.animations)
+		{
+			if (const EngineData::AnimationData* anim = AnimationLibrary::Get(id))
+				AddUnique(manifest.textures, anim->spritePath);
+		}
+	}
+
+	void Loader::Prewarm(const EngineData::LevelManifest& manifest)
+	{
+		Uint64 start = SDL_GetPerformanceCounter();
+
+		for (const auto& id : manifest.animations)
+		{
+			if (!AnimationLibrary::Get(id))
+			{
+				EngineCore::Log::Write(
+					EngineCore::LogLevel::Warning,
+					EngineCore::LogCategory::Scene,
+					"Manifest references unknown animation :" + id
+				);
+			}
+		}
+
+		//All decodes are queued at once so the workers run them in parallel
+		std::vector<EngineGame::TextureHandle> handles;
+		handles.reserve(manifest.textures.size());
+		for (const auto& texture : manifest.textures)
+			handles.push_back(AssetManager::AcquireTexture(texture, TexturePriority::Visible));
+
+		for (const auto& font : manifest.fonts)
+			RendererSdl::LoadFont(font);
+
+		AssetManager::WaitForTextures(handles);
+
+		double elapsedMs = (SDL_GetPerformanceCounter() - start) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+		EngineCore::Log::Write(
+			EngineCore::LogLevel::Info,
+			EngineCore::LogCategory::Scene,
+			"Level prewarmed : " + std::to_string(manifest.textures.size()) + " textures, " +
+			std::to_string(manifest.animations.size()) + " animations, " +
+			std::to_string(manifest.fonts.size()) + " fonts in " + std::to_string(elapsedMs) + " ms"
+		);
 	}
 
 	//Entities
@@ -180,10 +571,26 @@ namespace EnginePlatform
 		);
 	}
 
+	void Loader::SpawnEnemy(LoadContext& ctx, const EngineData::SpawnData& spawn)
+	{
+		const EngineData::EntityData* def = EntityLibrary::Get(spawn.defId);
+		if (!def)
+		{
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Warning,
+				EngineCore::LogCategory::Scene,
+				"Unknown enemy def:" + spawn.defId
+			);
+			return;
+		}
+
+		LoadEnemy(ctx, spawn, *def);
+	}
+
 	void Loader::LoadEnemy(LoadContext& ctx, const EngineData::SpawnData& spawn, const EngineData::EntityData& def)
 	{
 		//Enemy Loading
-		auto enemy = std::make_unique<EngineGame::Enemy>();
+		auto enemy = ctx.levelArena.Create<EngineGame::Enemy>();
 
 		//Set World Reference
 		enemy->SetWorld(ctx.tileMap.get());
@@ -214,33 +621,8 @@ namespace EnginePlatform
 	{
 		ctx.interactableList.Clear();
 
-		const int tileSize = ctx.tileMap->GetTileSize();
-
 		for (const auto& s : ctx.mapData.interactables)
-		{
-			const EngineData::InteractableData* def = InteractableLibrary::Get(s.defId);
-
-			if (!def)
-			{
-				EngineCore::Log::Write(
-					EngineCore::LogLevel::Warning,
-					EngineCore::LogCategory::Scene,
-					"Unknown interactable def:" + s.defId
-				);
-				continue;
-			}
-
-			EngineMath::Vector2 worldPos;
-			worldPos.x = static_cast<float>(s.x * tileSize);
-			worldPos.y = static_cast<float>(s.y * tileSize);
-
-			EngineGame::InteractableInstance instance;
-			instance.position = worldPos;
-			instance.def = def;
-			instance.collider.SetFromPositionSize(worldPos.x, worldPos.y, static_cast<float>(tileSize), static_cast<float>(tileSize));
-
-			ctx.interactableList.Add(instance);
-		}
+			SpawnInteractable(ctx, s);
 
 		EngineCore::Log::Write(
 			EngineCore::LogLevel::Info,
@@ -253,37 +635,64 @@ namespace EnginePlatform
 	{
 		ctx.trapList.Clear();
 
-		const int tileSize = ctx.tileMap->GetTileSize();
-
 		for (const auto& s : ctx.mapData.traps)
+			SpawnTrap(ctx, s);
+
+		EngineCore::Log::Write(
+			EngineCore::LogLevel::Info,
+			EngineCore::LogCategory::Scene,
+			"traps loaded :" + std::to_string(ctx.mapData.traps.size())
+		);
+	}
+	void Loader::SpawnInteractable(LoadContext& ctx, const EngineData::SpawnData& s)
+	{
+		const EngineData::InteractableData* def = InteractableLibrary::Get(s.defId);
+
+		if (!def)
 		{
-			const EngineData::TrapData* def = TrapLibrary::Get(s.defId);
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Warning,
+				EngineCore::LogCategory::Scene,
+				"Unknown interactable def:" + s.defId
+			);
+			return;
+		}
 
-			if (!def)
-			{
-				EngineCore::Log::Write(
-					EngineCore::LogLevel::Warning,
-					EngineCore::LogCategory::Scene,
-					"Unknown trap def:" + s.defId
-				);
-				continue;
-			}
+		const int tileSize = ctx.tileMap->GetTileSize();
+
+		EngineMath::Vector2 worldPos;
+		worldPos.x = static_cast<float>(s.x * tileSize);
+		worldPos.y = static_cast<float>(s.y * tileSize);
 
-			EngineMath::Vector2 worldPos;
-			worldPos.x = static_cast<float>(s.x * tileSize);
-			worldPos.y = static_cast<float>(s.y * tileSize);
+		EngineGame::InteractableInstance instance;
+		instance.position = worldPos;
+		instance.def = def;
+		instance.collider.SetFromPositionSize(worldPos.x, worldPos.y, static_cast<float>(tileSize), static_cast<float>(tileSize));
 
-			EngineGame::TrapInstance trap;
-			trap.def = def;
-			trap.position = worldPos;
+		ctx.interactableList.Add(instance);
+	}
+
+	void Loader::SpawnTrap(LoadContext& ctx, const EngineData::SpawnData& s)
+	{
+		const EngineData::TrapData* def = TrapLibrary::Get(s.defId);
 
-			ctx.trapList.Add(trap);
+		if (!def)
+		{
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Warning,
+				EngineCore::LogCategory::Scene,
+				"Unknown trap def:" + s.defId
+			);
+			return;
 		}
 
-		EngineCore::Log::Write(
-			EngineCore::LogLevel::Info,
-			EngineCore::LogCategory::Scene,
-			"traps loaded :" + std::to_string(ctx.mapData.traps.size())
-		);
+		const int tileSize = ctx.tileMap->GetTileSize();
+
+		EngineGame::TrapInstance trap;
+		trap.def = def;
+		trap.position.x = static_cast<float>(s.x * tileSize);
+		trap.position.y = static_cast<float>(s.y * tileSize);
+
+		ctx.trapList.Add(trap);
 	}
 }
\ No newline at end of file
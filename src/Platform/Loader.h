@@ -1,27 +1,46 @@
 #pragma once
 #include <string>
+#include <memory>
 #include "Platform/LoadContext.h"
 
 namespace EngineData
 {
 	struct EntityData;
 	struct SpawnData;
+	struct LevelManifest;
 }
 
 namespace EnginePlatform
 {
+	struct PreparedLevel;
+
 	class Loader
 	{
 	public:
 		void LoadBasics();
-		void LoadCurrentLevel(LoadContext& ctx);
+		void LoadCurrentLevel(LoadContext& ctx);	//Swaps in the prepared level when it is the current one
+
+		//Next level in the background, map parse and tile grid on a worker, then texture decodes are queued
+		void PrepareLevel(const std::string& mapId);
+		void UpdatePrepare();	//Main thread every frame while a level is being prepared
+
+		//Single spawns from map positions, also used by WorldStreamer as chunks come in
+		static void SpawnEnemy(LoadContext& ctx, const EngineData::SpawnData& spawn);
+		static void SpawnInteractable(LoadContext& ctx, const EngineData::SpawnData& spawn);
+		static void SpawnTrap(LoadContext& ctx, const EngineData::SpawnData& spawn);
 	private:
-		void LoadMap(LoadContext& ctx, const std::string& mapId);
+		bool LoadDefinitionBlob();
+		static bool ReadLevel(const std::string& mapId, PreparedLevel& outLevel);	//Any thread
+		void ActivateLevel(LoadContext& ctx, PreparedLevel& level);
+		void BuildManifest(const EngineData::MapData& map, bool cooked, EngineData::LevelManifest& manifest);	//Resolves a cooked manifest or computes one
+		void Prewarm(const EngineData::LevelManifest& manifest);
 		void LoadSpawnEntities(LoadContext& ctx);
 		void LoadPlayer(LoadContext& ctx, const EngineData::SpawnData& spawn, const EngineData::EntityData& def);
-		void LoadEnemy(LoadContext& ctx, const EngineData::SpawnData& spawn, const EngineData::EntityData& def);
+		static void LoadEnemy(LoadContext& ctx, const EngineData::SpawnData& spawn, const EngineData::EntityData& def);
 		void LoadCamera(LoadContext& ctx);
 		void LoadInteractables(LoadContext& ctx);
 		void LoadTraps(LoadContext& ctx);
+
+		std::shared_ptr<PreparedLevel> m_Prepared;	//Shared with the worker reading it
 	};
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "Game/Texture.h"
 #include "Core/PathUtil.h"
 #include "Core/Input.h"
+#include "Platform/AssetManager.h"
 
 namespace EnginePlatform
 {
@@ -13,22 +14,61 @@ namespace EnginePlatform
     const int segments = 24;
     const float step = 2.0f * 3.1415926f / segments;
 
+    //Streaming textures that are not uploaded yet are drawn with the placeholder,
+    //and bumped to the front of the decode queue when they are actually on screen
+    static EngineGame::Texture2D* ResolveStreamed(SDL_Renderer* renderer, EngineGame::Texture2D* texture, const SDL_FRect& dest)
+    {
+        if (texture->IsReady())
+            return texture;
+
+        int w = 0, h = 0;
+        SDL_GetCurrentRenderOutputSize(renderer, &w, &h);
+        bool onScreen = dest.x + dest.w >= 0.0f && dest.y + dest.h >= 0.0f && dest.x <= w && dest.y <= h;
+
+        if (onScreen)
+            AssetManager::Prioritize(texture->GetHandle());
+
+        return AssetManager::GetPlaceholder();
+    }
+
     void RendererSdl::Init()
     {
         s_Renderer = SDL_CreateRenderer(Window::Get(), nullptr);
+        SDL_HideCursor();
+    }
+
+    void RendererSdl::InitText()
+    {
         s_Instance = new RendererSdl();
 
-        SDL_HideCursor();
-        
-        std::string fontPath = EngineCore::GetFile("Fonts", "FontTest.ttf");
         TTF_Init();
-        s_Instance->m_Font = TTF_OpenFont(fontPath.c_str(), 14);
+        s_Instance->m_Font = LoadFont(EngineCore::GetFile("Fonts", UI_FONT_FILE));
+    }
+
+    TTF_Font* RendererSdl::LoadFont(const std::string& path)
+    {
+        auto it = s_Instance->m_Fonts.find(path);
+        if (it != s_Instance->m_Fonts.end())
+            return it->second.font;
+
+        EngineCore::FileData data;
+        if (!EngineCore::FileSystem::Read(path, data))
+            return nullptr;
+
+        TTF_Font* font = TTF_OpenFontIO(SDL_IOFromConstMem(data.GetData(), data.GetSize()), true, 14);
+        if (font)
+            s_Instance->m_Fonts.emplace(path, LoadedFont{ font, std::move(data) });
+
+        return font;
     }
 
     void RendererSdl::Shutdown()
     {
-        if (s_Instance->m_Font)
-            TTF_CloseFont(s_Instance->m_Font);
+        if (s_Instance)
+        {
+            for (auto& [path, loaded] : s_Instance->m_Fonts)
+                TTF_CloseFont(loaded.font);
+        }
 
         TTF_Quit();
         SDL_DestroyRenderer(s_Renderer);
@@ -96,13 +136,21 @@ namespace EnginePlatform
 
     void RendererSdl::DrawTexture(EngineGame::Texture2D* texture, const EngineCore::Rect& rect)
     {
+        if (!texture)
+            return;
+
         SDL_FRect r{ rect.x, rect.y, rect.w, rect.h };
+
+        texture = ResolveStreamed(s_Renderer, texture, r);
+        if (!texture)
+            return;
+
         SDL_RenderTexture(s_Renderer, texture->Get(), nullptr, &r);
     }
 
     void RendererSdl::DrawTexture(EngineGame::Texture2D* texture, const EngineCore::Rect& src, const EngineCore::Rect& dest, EngineCore::SpriteFlip flip)
     {
-        if (!texture || !texture->Get())
+        if (!texture)
             return;
 
         SDL_FRect s{ src.x, src.y, src.w, src.h };
@@ -111,6 +159,15 @@ namespace EnginePlatform
             SDL_FLIP_HORIZONTAL :
             SDL_FLIP_NONE;
 
+        if (!texture->IsReady())
+        {
+            //Placeholder covers the whole destination, the sprite sheet rect means nothing for it
+            texture = ResolveStreamed(s_Renderer, texture, d);
+            if (texture)
+                SDL_RenderTexture(s_Renderer, texture->Get(), nullptr, &d);
+            return;
+        }
+
         SDL_RenderTextureRotated(s_Renderer, texture->Get(), &s, &d, 0.0, nullptr, sdlFlip);
     }
 
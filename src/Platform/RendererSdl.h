@@ -2,17 +2,25 @@
 #include <SDL3/SDL.h>
 #include <SDL3_ttf/SDL_ttf.h>
 #include "Core/IRenderer.h"
+#include "Core/FileSystem.h"
+#include <string>
+#include <unordered_map>
 
 namespace EnginePlatform
 {
     class RendererSdl : public EngineCore::IRenderer
     {
     public:
-        static void Init();
+        static void Init();         //Main thread, after Window::Init
+        static void InitText();     //TTF and the UI font, no video calls so any thread
         static void Shutdown();
         static EngineCore::IRenderer* Get();
         static SDL_Renderer* GetSdl();
 
+        //Fonts, opened once per path
+        static constexpr const char* UI_FONT_FILE = "FontTest.ttf";
+        static TTF_Font* LoadFont(const std::string& path);
+
         void BeginFrame() override;
         void EndFrame() override;
         void Clear(const EngineCore::Color& color) override;
@@ -42,5 +50,12 @@ namespace EnginePlatform
         static RendererSdl* s_Instance;
 
         TTF_Font* m_Font = nullptr;
+        struct LoadedFont
+        {
+            TTF_Font* font;
+            EngineCore::FileData data;  //TTF keeps reading from it while the font is open
+        };
+
+        std::unordered_map<std::string, LoadedFont> m_Fonts;
     };
 }
\ No newline at end of file
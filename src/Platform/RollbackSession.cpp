@@ -0,0 +1,442 @@
+#include "Platform/RollbackSession.h"
+#include "Platform/Scene.h"
+#include "Core/Hash.h"
+#include "Core/Log.h"
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <iterator>
+#include <cstring>
+
+namespace EnginePlatform
+{
+	constexpr uint32_t NETPLAY_MAGIC = 0x504E5454;		//"TTNP"
+	constexpr uint16_t NETPLAY_VERSION = 1;
+	constexpr int MAX_PACKET_INPUTS = 64;
+	constexpr int MAX_TICKS_PER_UPDATE = 4;
+	constexpr float PEER_TIMEOUT = 2.0f;
+
+	//Keys a frame carries, the rest (menus, quick save, debug) stay with the window
+	constexpr EngineCore::KeyCode NETPLAY_KEYS[] = {
+		EngineCore::KeyCode::W,
+		EngineCore::KeyCode::A,
+		EngineCore::KeyCode::S,
+		EngineCore::KeyCode::D,
+		EngineCore::KeyCode::E,
+		EngineCore::KeyCode::F5
+	};
+
+	//Every datagram repeats the inputs the peer has not acknowledged, so a lost one costs nothing
+	struct NetplayHeader
+	{
+		uint32_t magic;
+		uint16_t version;
+		uint8_t player;			//Sender
+		uint8_t count;			//Inputs that follow, one uint16_t each
+		int32_t firstFrame;
+		int32_t ackFrame;		//Receiver's inputs the sender has up to here
+		int32_t hashFrame;		//-1 when no state hash is final yet
+		uint32_t hash;
+	};
+
+	static_assert(sizeof(NetplayHeader) == 24, "Netplay header is sent as raw bytes");
+
+	RollbackSession::RollbackSession(Scene& scene, EngineCore::InputState& input)
+		: m_Scene(scene), m_Input(input)
+	{
+	}
+
+	bool RollbackSession::Start(const NetplaySettings& settings)
+	{
+		Stop();
+
+		if (settings.player != 0 && settings.player != 1)
+		{
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Error,
+				EngineCore::LogCategory::Scene,
+				"Netplay player has to be 0 or 1"
+			);
+			return false;
+		}
+
+		if (!m_Socket.Open(settings.localPort, settings.peerHost, settings.peerPort))
+			return false;
+
+		m_Settings = settings;
+		m_Frames.assign(FRAME_RING, Frame{});
+		std::fill(std::begin(m_Inputs), std::end(m_Inputs), FrameInput{});
+		std::fill(std::begin(m_Hashes), std::end(m_Hashes), StateHash{});
+
+		m_Frame = 0;
+		m_RemoteConfirmed = -1;
+		m_RemoteAck = -1;
+		m_RollbackFrom = -1;
+		m_Sampled = 0;
+		m_Hashed = -1;
+		m_PeerHash = {};
+		m_Finished = false;
+		m_LocalInput = 0;
+		m_Accumulator = 0.0f;
+		m_SinceReceive = 0.0f;
+		m_WaitLogged = false;
+		m_Stats = {};
+
+		//Frame 0 is the freshly loaded level on both sides
+		m_Input.Reset();
+		m_Scene.LoadCurrentLevel();
+		m_Scene.ChangeGameState(GameState::Playing);
+
+		EngineCore::Log::Write(
+			EngineCore::LogLevel::Info,
+			EngineCore::LogCategory::Scene,
+			"Netplay started as player " + std::to_string(settings.player) + ", peer " + settings.peerHost + ":" + std::to_string(settings.peerPort)
+		);
+		return true;
+	}
+
+	void RollbackSession::Stop()
+	{
+		m_Socket.Close();
+	}
+
+	void RollbackSession::Update(float dt, const EngineCore::InputState& local)
+	{
+		if (!IsActive())
+			return;
+
+		m_Scene.UpdateLoading();
+		m_SinceReceive += dt;
+		Receive();
+
+		if (m_Finished)
+		{
+			//Late datagrams still get their acknowledgement so the peer can finish too
+			Send();
+
+			uint16_t input = PackInput(local);
+			ApplyInput(m_LocalInput, input);
+			m_LocalInput = input;
+			m_Scene.Update(dt);
+			return;
+		}
+
+		if (m_RollbackFrom >= 0)
+			Rollback(m_RollbackFrom);
+		ConfirmHashes();
+
+		//Stalls keep at most a few ticks of time, a slow peer is not caught up on in one burst
+		const float step = m_Settings.fixedDt;
+		m_Accumulator = std::min(m_Accumulator + dt, step * MAX_TICKS_PER_UPDATE);
+		while (m_Accumulator >= step)
+		{
+			if (!Advance(local))
+			{
+				m_Stats.stalls++;
+				break;
+			}
+
+			m_Accumulator -= step;
+		}
+
+		ConfirmHashes();
+		Send();
+
+		//Only a confirmed frame ends the session, a guess that finished the game can still be taken back
+		if (m_Scene.GetGameState() == GameState::MainMenu && m_Frame - 1 <= m_RemoteConfirmed)
+		{
+			m_Finished = true;
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Info,
+				EngineCore::LogCategory::Scene,
+				"Netplay finished at frame " + std::to_string(m_Frame) + ", the game continues locally"
+			);
+		}
+
+		m_Stats.frame = m_Frame;
+		m_Stats.confirmedFrame = m_RemoteConfirmed;
+		m_Stats.connected = m_SinceReceive < PEER_TIMEOUT;
+
+		if (!m_Stats.connected && !m_WaitLogged)
+		{
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Warning,
+				EngineCore::LogCategory::Scene,
+				"Netplay is waiting for the peer at frame " + std::to_string(m_Frame)
+			);
+		}
+		m_WaitLogged = !m_Stats.connected;
+	}
+
+	bool RollbackSession::Advance(const EngineCore::InputState& local)
+	{
+		int frame = m_Frame;
+
+		//Guesses only run so far ahead, and this player's inputs wait in the ring until the peer has them
+		if (frame - m_RemoteConfirmed > MAX_ROLLBACK || frame - m_RemoteAck >= INPUT_RING)
+			return false;
+
+		//A frame that cannot be saved cannot be taken back, it waits for the peer's real input
+		if (!Save(frame) && frame > m_RemoteConfirmed)
+			return false;
+
+		//A frame that was dropped by a rollback keeps the input already sent for it
+		if (frame >= m_Sampled)
+		{
+			m_Inputs[frame % INPUT_RING].local = PackInput(local);
+			m_Sampled = frame + 1;
+		}
+
+		Run(frame);
+		m_Frame = frame + 1;
+		return true;
+	}
+
+	bool RollbackSession::Save(int frame)
+	{
+		Frame& slot = m_Frames[frame % FRAME_RING];
+		slot.frame = frame;
+		slot.level = m_Scene.GetLevelIndex();
+		slot.saved = m_Scene.SaveFrame(slot.snapshot, slot.checkpoint);
+		return slot.saved;
+	}
+
+	void RollbackSession::Run(int frame)
+	{
+		FrameInput& input = m_Inputs[frame % INPUT_RING];
+
+		//The guess is the peer's last known input, players mostly keep holding what they held
+		if (frame > m_RemoteConfirmed)
+			input.remote = m_RemoteConfirmed >= 0 ? m_Inputs[m_RemoteConfirmed % INPUT_RING].remote : 0;
+
+		input.applied = input.local | input.remote;
+		uint16_t previous = frame > 0 ? m_Inputs[(frame - 1) % INPUT_RING].applied : 0;
+		ApplyInput(previous, input.applied);
+
+		//The death screen waits for a click alone, together both games restart on the same frame
+		if (m_Scene.GetGameState() == GameState::DeathScreen)
+			m_Scene.RestartLevel();
+		else
+			m_Scene.Simulate(m_Settings.fixedDt);
+	}
+
+	void RollbackSession::Rollback(int from)
+	{
+		m_RollbackFrom = -1;
+
+		Uint64 start = SDL_GetPerformanceCounter();
+
+		const Frame& slot = m_Frames[from % FRAME_RING];
+		if (slot.frame != from || !slot.saved || !m_Scene.LoadFrame(slot.snapshot, slot.checkpoint, slot.level))
+		{
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Error,
+				EngineCore::LogCategory::Scene,
+				"Netplay could not take back frame " + std::to_string(from)
+			);
+			return;
+		}
+
+		int end = m_Frame;
+		for (int frame = from; frame < end; frame++)
+		{
+			//Frames that now leave play are dropped, they run again once the peer's input is in
+			if (frame > from && !Save(frame) && frame > m_RemoteConfirmed)
+			{
+				m_Frame = frame;
+				break;
+			}
+
+			Run(frame);
+		}
+
+		float elapsedMs = float((SDL_GetPerformanceCounter() - start) * 1000.0 / (double)SDL_GetPerformanceFrequency());
+		m_Stats.lastRollback = end - from;
+		m_Stats.lastRollbackMs = elapsedMs;
+
+		//The whole window has to fit in one frame or the game falls behind the peer
+		if (elapsedMs > m_Settings.fixedDt * 1000.0f && elapsedMs > m_Stats.maxRollbackMs)
+		{
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Warning,
+				EngineCore::LogCategory::Scene,
+				"Netplay rollback of " + std::to_string(end - from) + " frames took " + std::to_string(elapsedMs) + " ms, longer than a frame"
+			);
+		}
+		m_Stats.maxRollbackMs = std::max(m_Stats.maxRollbackMs, elapsedMs);
+	}
+
+	void RollbackSession::ApplyInput(uint16_t previous, uint16_t current)
+	{
+		//Rebuilt from two frames of bits, so a replayed frame sees the same presses as the first run
+		for (size_t i = 0; i < std::size(NETPLAY_KEYS); i++)
+		{
+			bool was = (previous >> i) & 1;
+			bool is = (current >> i) & 1;
+
+			EngineCore::KeyState state = EngineCore::KeyState::None;
+			if (is)
+				state = was ? EngineCore::KeyState::Held : EngineCore::KeyState::Pressed;
+			else if (was)
+				state = EngineCore::KeyState::Released;
+
+			m_Input.SetKeyState(NETPLAY_KEYS[i], state);
+		}
+	}
+
+	uint16_t RollbackSession::PackInput(const EngineCore::InputState& input)
+	{
+		uint16_t bits = 0;
+		for (size_t i = 0; i < std::size(NETPLAY_KEYS); i++)
+		{
+			if (input.IsKeyDown(NETPLAY_KEYS[i]))
+				bits |= uint16_t(1u << i);
+		}
+
+		return bits;
+	}
+
+	void RollbackSession::Receive()
+	{
+		uint8_t buffer[sizeof(NetplayHeader) + MAX_PACKET_INPUTS * sizeof(uint16_t)];
+		while (size_t size = m_Socket.Receive(buffer, sizeof(buffer)))
+		{
+			NetplayHeader header;
+			if (size < sizeof(header))
+				continue;
+
+			std::memcpy(&header, buffer, sizeof(header));
+			if (header.magic != NETPLAY_MAGIC || header.version != NETPLAY_VERSION ||
+				header.player == m_Settings.player || header.count > MAX_PACKET_INPUTS ||
+				size < sizeof(header) + header.count * sizeof(uint16_t))
+				continue;
+
+			m_SinceReceive = 0.0f;
+			m_RemoteAck = std::max(m_RemoteAck, std::min<int>(header.ackFrame, m_Sampled - 1));
+
+			//Inputs are taken in order only, a repeat is skipped and a gap waits for the next datagram
+			for (int i = 0; i < header.count; i++)
+			{
+				int frame = header.firstFrame + i;
+				if (frame <= m_RemoteConfirmed)
+					continue;
+				if (frame != m_RemoteConfirmed + 1 || frame - m_RemoteAck >= INPUT_RING)
+					break;
+
+				uint16_t bits;
+				std::memcpy(&bits, buffer + sizeof(header) + i * sizeof(uint16_t), sizeof(bits));
+
+				FrameInput& input = m_Inputs[frame % INPUT_RING];
+				if (frame < m_Frame && input.remote != bits && (m_RollbackFrom < 0 || frame < m_RollbackFrom))
+					m_RollbackFrom = frame;
+
+				input.remote = bits;
+				m_RemoteConfirmed = frame;
+			}
+
+			if (header.hashFrame >= 0)
+			{
+				if (header.hashFrame <= m_Hashed)
+					CheckHash(header.hashFrame, header.hash);
+				else
+					m_PeerHash = { header.hashFrame, header.hash };
+			}
+		}
+	}
+
+	void RollbackSession::Send()
+	{
+		int first = m_RemoteAck + 1;
+		int count = std::clamp(m_Sampled - first, 0, MAX_PACKET_INPUTS);
+
+		NetplayHeader header{};
+		header.magic = NETPLAY_MAGIC;
+		header.version = NETPLAY_VERSION;
+		header.player = (uint8_t)m_Settings.player;
+		header.count = (uint8_t)count;
+		header.firstFrame = first;
+		header.ackFrame = m_RemoteConfirmed;
+		header.hashFrame = -1;
+
+		if (m_Hashed >= 0 && m_Hashes[m_Hashed % HASH_RING].hash != 0)
+		{
+			header.hashFrame = m_Hashed;
+			header.hash = m_Hashes[m_Hashed % HASH_RING].hash;
+		}
+
+		uint8_t buffer[sizeof(NetplayHeader) + MAX_PACKET_INPUTS * sizeof(uint16_t)];
+		std::memcpy(buffer, &header, sizeof(header));
+		for (int i = 0; i < count; i++)
+			std::memcpy(buffer + sizeof(header) + i * sizeof(uint16_t), &m_Inputs[(first + i) % INPUT_RING].local, sizeof(uint16_t));
+
+		m_Socket.Send(buffer, sizeof(header) + count * sizeof(uint16_t));
+	}
+
+	void RollbackSession::ConfirmHashes()
+	{
+		//A frame's saved state is final once every input before it is in and any rollback has run
+		int last = std::min(m_RemoteConfirmed + 1, m_Frame - 1);
+		for (int frame = m_Hashed + 1; frame <= last; frame++)
+		{
+			const Frame& slot = m_Frames[frame % FRAME_RING];
+			m_Hashes[frame % HASH_RING] = { frame, slot.frame == frame && slot.saved ? HashState(slot.snapshot) : 0u };
+			m_Hashed = frame;
+		}
+
+		if (m_PeerHash.frame >= 0 && m_PeerHash.frame <= m_Hashed)
+		{
+			CheckHash(m_PeerHash.frame, m_PeerHash.hash);
+			m_PeerHash = {};
+		}
+	}
+
+	void RollbackSession::CheckHash(int frame, uint32_t hash)
+	{
+		//Frames outside play have no state to compare
+		const StateHash& local = m_Hashes[frame % HASH_RING];
+		if (local.frame != frame || local.hash == 0 || hash == 0 || local.hash == hash || m_Stats.desyncFrame >= 0)
+			return;
+
+		m_Stats.desyncFrame = frame;
+		EngineCore::Log::Write(
+			EngineCore::LogLevel::Error,
+			EngineCore::LogCategory::Scene,
+			"Netplay desync at frame " + std::to_string(frame) + ", the two games no longer match"
+		);
+	}
+
+	uint32_t RollbackSession::HashState(const EngineGame::SceneSnapshot& snapshot)
+	{
+		//Gameplay fields only, padding and animation playback do not decide anything
+		uint32_t hash = EngineCore::HashFnv1a32(&snapshot.levelCompleted, sizeof(snapshot.levelCompleted));
+
+		auto hashEntity = [&hash](const EngineGame::EntitySnapshot& entity)
+		{
+			hash = EngineCore::HashFnv1a32(&entity.position, sizeof(entity.position), hash);
+			hash = EngineCore::HashFnv1a32(&entity.velocity, sizeof(entity.velocity), hash);
+			hash = EngineCore::HashFnv1a32(&entity.hp, sizeof(entity.hp), hash);
+			hash = EngineCore::HashFnv1a32(&entity.isDead, sizeof(entity.isDead), hash);
+		};
+
+		hashEntity(snapshot.player.entity);
+		hash = EngineCore::HashFnv1a32(&snapshot.player.state, sizeof(snapshot.player.state), hash);
+		hash = EngineCore::HashFnv1a32(&snapshot.player.hasKey, sizeof(snapshot.player.hasKey), hash);
+
+		for (uint32_t i = 0; i < snapshot.enemyCount; i++)
+		{
+			hashEntity(snapshot.enemies[i].entity);
+			hash = EngineCore::HashFnv1a32(&snapshot.enemies[i].state, sizeof(snapshot.enemies[i].state), hash);
+		}
+
+		for (uint32_t i = 0; i < snapshot.trapCount; i++)
+		{
+			hash = EngineCore::HashFnv1a32(&snapshot.traps[i].position, sizeof(snapshot.traps[i].position), hash);
+			hash = EngineCore::HashFnv1a32(&snapshot.traps[i].timer, sizeof(snapshot.traps[i].timer), hash);
+			hash = EngineCore::HashFnv1a32(&snapshot.traps[i].active, sizeof(snapshot.traps[i].active), hash);
+		}
+
+		for (uint32_t i = 0; i < snapshot.interactableCount; i++)
+			hash = EngineCore::HashFnv1a32(&snapshot.interactables[i].used, sizeof(snapshot.interactables[i].used), hash);
+
+		return hash != 0 ? hash : 1;
+	}
+}
\ No newline at end of file
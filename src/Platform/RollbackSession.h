@@ -0,0 +1,119 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "Core/Input.h"
+#include "Core/UdpSocket.h"
+#include "Game/Snapshot.h"
+
+namespace EnginePlatform
+{
+	class Scene;
+
+	struct NetplaySettings
+	{
+		bool enabled = false;
+		int player = 0;						//0 or 1, the peer takes the other one
+		uint16_t localPort = 47100;
+		std::string peerHost = "127.0.0.1";
+		uint16_t peerPort = 47101;
+		float fixedDt = 1.0f / 60.0f;
+	};
+
+	struct NetplayStats
+	{
+		int frame = 0;					//Next frame to simulate
+		int confirmedFrame = -1;		//Last frame with the peer's input
+		int lastRollback = 0;			//Frames simulated again
+		float lastRollbackMs = 0.0f;
+		float maxRollbackMs = 0.0f;
+		int stalls = 0;					//Ticks spent waiting for the peer
+		int desyncFrame = -1;			//First frame whose state hash differed from the peer's
+		bool connected = false;
+	};
+
+	//Two players drive one Scene, each frame runs on a guess of the peer's input and is taken back and simulated
+	//again once the real input arrives. The game has one character, so both players' keys are merged into its input.
+	class RollbackSession
+	{
+	public:
+		static constexpr int MAX_ROLLBACK = 8;			//Frames a guess can run ahead of the peer
+
+		//input is what the scene's player reads, the session writes it every frame
+		RollbackSession(Scene& scene, EngineCore::InputState& input);
+
+		//Starts the current level, both peers have to begin from the same level
+		bool Start(const NetplaySettings& settings);
+		void Stop();
+		bool IsActive() const { return m_Socket.IsOpen(); }
+
+		//Once per rendered frame instead of Scene::Update, local is this player's window input
+		void Update(float dt, const EngineCore::InputState& local);
+
+		const NetplayStats& GetStats() const { return m_Stats; }
+	private:
+		static constexpr int FRAME_RING = 16;		//Snapshots, more than MAX_ROLLBACK + 1
+		static constexpr int INPUT_RING = 128;		//Inputs kept until the peer has them
+		static constexpr int HASH_RING = 128;		//Confirmed state hashes the peer's can still be checked against
+
+		struct Frame
+		{
+			EngineGame::SceneSnapshot snapshot;		//State before the frame ran
+		EngineGame::SceneSnapshot checkpoint;	//Scene's checkpoint at that point
+			int frame = -1;
+			int level = -1;
+			bool saved = false;						//Leaving play is only simulated once the peer's input is in
+		};
+
+		struct FrameInput
+		{
+			uint16_t local = 0;
+			uint16_t remote = 0;		//Received, or guessed until then
+			uint16_t applied = 0;		//Both merged, what the frame ran with
+		};
+
+		struct StateHash
+		{
+			int frame = -1;
+			uint32_t hash = 0;
+		};
+
+		bool Advance(const EngineCore::InputState& local);
+		bool Save(int frame);
+		void Run(int frame);
+		void Rollback(int from);
+		void ApplyInput(uint16_t previous, uint16_t current);
+		void Receive();
+		void Send();
+		void ConfirmHashes();
+		void CheckHash(int frame, uint32_t hash);
+
+		static uint16_t PackInput(const EngineCore::InputState& input);
+		static uint32_t HashState(const EngineGame::SceneSnapshot& snapshot);
+
+		Scene& m_Scene;
+		EngineCore::InputState& m_Input;
+		EngineCore::UdpSocket m_Socket;
+		NetplaySettings m_Settings;
+
+		std::vector<Frame> m_Frames;
+		FrameInput m_Inputs[INPUT_RING];
+		StateHash m_Hashes[HASH_RING];
+
+		int m_Frame = 0;
+		int m_RemoteConfirmed = -1;		//Peer's inputs up to here are in
+		int m_RemoteAck = -1;			//Peer has our inputs up to here
+		int m_RollbackFrom = -1;		//Earliest frame that ran on a wrong guess
+		int m_Sampled = 0;				//Frames with this player's input, kept when a frame runs again
+		int m_Hashed = -1;				//Last frame whose state hash is final
+		StateHash m_PeerHash;			//Peer's newest hash, checked once ours for that frame is final
+		bool m_Finished = false;		//Every level is done, the rest plays locally
+		uint16_t m_LocalInput = 0;		//Last frame's keys once finished
+
+		float m_Accumulator = 0.0f;
+		float m_SinceReceive = 0.0f;
+		bool m_WaitLogged = false;
+
+		NetplayStats m_Stats;
+	};
+}
\ No newline at end of file
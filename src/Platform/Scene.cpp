@@ -2,6 +2,10 @@
 #include "Core/Log.h"
 #include "Core/Math/Collision.h"
 #include "Platform/LevelManager.h"
+#include "Platform/LibraryManager.h"
+#include "Core/PathUtil.h"
+#include <filesystem>
+#include <algorithm>
 
 namespace EnginePlatform
 {
@@ -11,9 +15,11 @@ namespace EnginePlatform
 	constexpr float TEXT_POP_SPEED = 6.0f;
 	constexpr float TEXT_MAX_SCALE = 1.2f;
 
-	Scene::Scene()
-		: m_Camera(800.0f, 600.0f)
+	Scene::Scene(EngineContext& context)
+		: m_Context(context), m_Enemies(m_LevelArena.GetResource()), m_Camera(800.0f, 600.0f),
+		m_InteractableManager(m_LevelArena), m_TrapManager(m_LevelArena)
 	{
+		m_Player.SetInput(&context.GetInput());
 	}
 
 	void Scene::Load()
@@ -25,14 +31,38 @@ namespace EnginePlatform
 		);
 
 		ChangeGameState(GameState::MainMenu);
-		m_Loader.LoadBasics();
 		m_InteractableManager.SetOnLevelComplete([this]()
 		{
 			OnLevelCompleted();;
 		});
 	}
 
+	void Scene::LoadDefinitions()
+	{
+		m_Loader.LoadBasics();
+	}
+
+	void Scene::PrefetchCurrentLevel()
+	{
+		const EngineData::LevelData* level = m_Context.GetLevels().GetCurrentLevel();
+		if (level != nullptr)
+			m_Loader.PrepareLevel(level->mapId);
+	}
+
 	void Scene::Update(float dt)
+	{
+		UpdateLoading();
+		Simulate(dt);
+	}
+
+	void Scene::UpdateLoading()
+	{
+		//Prepared level streams in behind the menu, the text and the fade, headless games have no textures to queue
+		if (!m_Context.IsHeadless())
+			m_Loader.UpdatePrepare();
+	}
+
+	void Scene::Simulate(float dt)
 	{
 		switch (m_GameState)
 		{
@@ -93,6 +123,33 @@ namespace EnginePlatform
 			return;
 		}
 
+		//Quick save
+		if (m_Context.GetInput().IsKeyPressed(EngineCore::KeyCode::F8) && SaveSnapshot(m_QuickSave))
+		{
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Info,
+				EngineCore::LogCategory::Scene,
+				"Quick save taken"
+			);
+		}
+
+		if (m_Context.GetInput().IsKeyPressed(EngineCore::KeyCode::F9) && RestoreSnapshot(m_QuickSave))
+		{
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Info,
+				EngineCore::LogCategory::Scene,
+				"Quick save loaded"
+			);
+			return;
+		}
+
+		//Chunks come and go before anything below looks at the enemy list
+		if (m_World.IsOpen())
+		{
+			LoadContext ctx = GetLoadContext();
+			m_World.Update(ctx, m_Player.GetPosition());
+		}
+
 		m_Player.Update(dt);
 		m_InteractableManager.Update(m_Player);
 		m_TrapManager.Update(dt, m_Player);
@@ -106,8 +163,14 @@ namespace EnginePlatform
 
 			m_HUD.SetInteractPopup(true, screenX, screenY);
 
-			if (EngineCore::Input::IsKeyPressed(EngineCore::KeyCode::F5))
+			if (m_Context.GetInput().IsKeyPressed(EngineCore::KeyCode::F5))
+			{
 				m_InteractableManager.HandleInteraction(m_Player);
+
+				//Interactions are the checkpoints, a finished level already moved on
+				if (m_GameState == GameState::Playing)
+					SaveSnapshot(m_Checkpoint);
+			}
 		}
 		else
 		{
@@ -118,13 +181,20 @@ namespace EnginePlatform
 		{
 			auto& e = *it;
 
+			//Dead enemies stay in the list so a snapshot can bring them back
+			if (e->IsDead())
+			{
+				++it;
+				continue;
+			}
+
 			//Enemy AI update
 			e->Update(dt, m_Player.GetPosition(), m_Player.GetCollider());
 
 			//Enemy died
 			if (e->IsDead())
 			{
-				it = m_Enemies.erase(it);
+				++it;
 				continue;
 			}
 
@@ -190,7 +260,10 @@ namespace EnginePlatform
 			m_TrapManager.Render(renderer, m_Camera);
 			m_TrapManager.DebugDraw(renderer, m_Camera);
 			for (auto& e : m_Enemies)
-				e->Render(renderer, m_Camera);
+			{
+				if (!e->IsDead())
+					e->Render(renderer, m_Camera);
+			}
 			break;
 		default:
 			break;
@@ -204,15 +277,125 @@ namespace EnginePlatform
 	{
 		LoadContext ctx = GetLoadContext();
 		m_Loader.LoadCurrentLevel(ctx);
+
+		m_Checkpoint.valid = false;
+		SaveSnapshot(m_LevelStart);
+	}
+
+	void Scene::RestartLevel()
+	{
+		//Rewinds to the last checkpoint or the level start, the level is only reloaded when neither fits
+		if (RestoreSnapshot(m_Checkpoint) || RestoreSnapshot(m_LevelStart))
+		{
+			ChangeGameState(GameState::Playing);
+			return;
+		}
+
+		StartGame();
+	}
+
+	//Snapshots
+	bool Scene::SaveFrame(EngineGame::SceneSnapshot& out, EngineGame::SceneSnapshot& outCheckpoint) const
+	{
+		out.valid = false;
+		if (m_GameState != GameState::Playing || !SaveSnapshot(out, false))
+			return false;
+
+		outCheckpoint = m_Checkpoint;
+		return true;
+	}
+
+	bool Scene::LoadFrame(const EngineGame::SceneSnapshot& frame, const EngineGame::SceneSnapshot& checkpoint, int levelIndex)
+	{
+		//A level finished in the frames taken back, its objects stay loaded until the fade ends, well past any rollback
+		if (m_Context.GetLevels().GetCurrentIndex() != levelIndex)
+			m_Context.GetLevels().StartLevelByIndex(levelIndex);
+
+		if (!RestoreSnapshot(frame))
+			return false;
+
+		m_Checkpoint = checkpoint;
+		ChangeGameState(GameState::Playing);
+		return true;
+	}
+
+	bool Scene::SaveSnapshot(EngineGame::SceneSnapshot& out, bool warn) const
+	{
+		out.valid = false;
+
+		//Streamed worlds keep their state per chunk, restarts reload them
+		const EngineData::LevelData* level = m_Context.GetLevels().GetCurrentLevel();
+		if (!level || !m_TileMap || m_World.IsOpen())
+			return false;
+
+		bool fits = m_Enemies.size() <= EngineGame::SceneSnapshot::MAX_ENEMIES &&
+			m_TrapManager.SaveState(out.traps, out.trapCount) &&
+			m_InteractableManager.SaveState(out.interactables, out.interactableCount);
+
+		if (!fits)
+		{
+			if (!warn)
+				return false;
+
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Warning,
+				EngineCore::LogCategory::Scene,
+				"Level has more objects than a snapshot holds, restarts reload the level"
+			);
+			return false;
+		}
+
+		out.map = EngineCore::StringId(level->mapId);
+		out.levelCompleted = m_LevelCompleted;
+		m_Player.SaveState(out.player);
+		m_Camera.SaveState(out.camera);
+
+		out.enemyCount = (uint32_t)m_Enemies.size();
+		for (size_t i = 0; i < m_Enemies.size(); i++)
+			m_Enemies[i]->SaveState(out.enemies[i]);
+
+		out.valid = true;
+		return true;
+	}
+
+	bool Scene::RestoreSnapshot(const EngineGame::SceneSnapshot& snapshot)
+	{
+		const EngineData::LevelData* level = m_Context.GetLevels().GetCurrentLevel();
+		if (!snapshot.valid || !level || snapshot.map != EngineCore::StringId(level->mapId))
+			return false;
+
+		//Objects are only created by the level load, so a matching level has the same enemies and traps.
+		//Everything is checked first, a restore that fails leaves the scene as it was.
+		std::span<const EngineGame::TrapSnapshot> traps(snapshot.traps, snapshot.trapCount);
+		std::span<const EngineGame::InteractableSnapshot> interactables(snapshot.interactables, snapshot.interactableCount);
+		if (snapshot.enemyCount != m_Enemies.size() ||
+			!m_TrapManager.CanLoadState(traps) ||
+			!m_InteractableManager.CanLoadState(interactables))
+			return false;
+
+		m_TrapManager.LoadState(traps);
+		m_InteractableManager.LoadState(interactables);
+
+		m_LevelCompleted = snapshot.levelCompleted;
+		m_Player.LoadState(snapshot.player);
+		m_Camera.LoadState(snapshot.camera);
+
+		for (size_t i = 0; i < m_Enemies.size(); i++)
+			m_Enemies[i]->LoadState(snapshot.enemies[i]);
+
+		m_HUD.SetInteractPopup(false, 0, 0);
+		return true;
 	}
 
 	void Scene::OnLevelCompleted()
 	{
 		m_HUD.SetInteractPopup(false, 0, 0);
-		LevelManager::Get().LoadNextLevel();
+		m_Context.GetLevels().LoadNextLevel();
 
-		if (LevelManager::Get().GetCurrentLevel() != nullptr)
+		const EngineData::LevelData* level = m_Context.GetLevels().GetCurrentLevel();
+		if (level != nullptr)
 		{
+			m_Loader.PrepareLevel(level->mapId);
 			ChangeGameState(GameState::LevelComplete);
 			m_LevelCompleteTimer = 0.0f;
 			m_FadeOut = true;
@@ -230,9 +413,193 @@ namespace EnginePlatform
 		}
 	}
 
+	//Hot Reload
+	void Scene::ApplyReload(const ReloadSet& reloaded)
+	{
+		if (m_GameState != GameState::Playing)
+			return;
+
+		//Entity definitions rebuild every animation they name, the rest only refresh edited animations
+		std::vector<EngineGame::Entity*> entities{ &m_Player };
+		for (auto& e : m_Enemies)
+			entities.push_back(e.get());
+
+		for (EngineGame::Entity* entity : entities)
+		{
+			const EngineData::EntityData* def = nullptr;
+			if (std::find(reloaded.entities.begin(), reloaded.entities.end(), entity->GetDefinitionKey()) != reloaded.entities.end())
+				def = EntityLibrary::Get(entity->GetDefinitionKey());
+
+			if (def)
+				entity->ReloadDefinition(*def);
+			else if (!reloaded.animations.empty())
+				entity->RefreshAnimations(reloaded.animations);
+		}
+
+		m_TrapManager.RefreshDefinitions(reloaded.traps);
+		m_InteractableManager.RefreshDefinitions(reloaded.interactables);
+
+		if (!reloaded.maps.empty())
+			ReloadMap(reloaded.maps);
+	}
+
+	void Scene::ApplyLiveEdits(const LiveEdits& edits)
+	{
+		if (!edits.definitions.IsEmpty())
+			ApplyReload(edits.definitions);
+
+		if (m_GameState != GameState::Playing)
+			return;
+
+		for (const auto& edit : edits.maps)
+			ApplyMapEdit(edit);
+	}
+
+	void Scene::ApplyMapEdit(const LiveMapEdit& edit)
+	{
+		const EngineData::LevelData* level = m_Context.GetLevels().GetCurrentLevel();
+		if (!level || !m_TileMap || level->mapId != edit.mapId)
+			return;
+
+		if (m_TileMap->IsChunked())
+		{
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Warning,
+				EngineCore::LogCategory::Scene,
+				"Streamed levels play the cooked world, live edits are skipped : " + edit.mapId
+			);
+			return;
+		}
+
+		//Only the cells the editor touched are written, the next frame draws and collides with them
+		int width = m_TileMap->GetWidth();
+		size_t cells = size_t(width) * m_TileMap->GetHeight();
+		for (const auto& tile : edit.tiles)
+		{
+			if (tile.index < cells)
+				m_TileMap->SetTile(int(tile.index % width), int(tile.index / width), tile.type);
+		}
+
+		for (const auto& move : edit.spawns)
+			MoveSpawn(move);
+	}
+
+	void Scene::MoveSpawn(const LiveSpawnMove& move)
+	{
+		float tileSize = (float)m_TileMap->GetTileSize();
+		EngineMath::Vector2 from(move.from.x * tileSize, move.from.y * tileSize);
+		EngineMath::Vector2 to(move.to.x * tileSize, move.to.y * tileSize);
+
+		bool moved = true;
+		switch (move.kind)
+		{
+		case EngineCore::LiveSpawnKind::Player:
+		{
+			//The player keeps playing where it is, respawns and restarts use the new point
+			m_Player.SetSpawnPoint(to);
+			for (EngineGame::SceneSnapshot* snapshot : { &m_LevelStart, &m_Checkpoint })
+			{
+				if (!snapshot->valid)
+					continue;
+
+				//A checkpoint keeps the player where it was reached, only its spawn point follows the move
+				if (snapshot == &m_LevelStart)
+				{
+					EngineMath::Vector2 delta = to - snapshot->player.spawnPoint;
+					snapshot->player.entity.position += delta;
+					snapshot->player.entity.collider.Translate(delta);
+				}
+				snapshot->player.spawnPoint = to;
+			}
+			break;
+		}
+		case EngineCore::LiveSpawnKind::Interactable:
+			moved = m_InteractableManager.Move(from, to);
+			break;
+		case EngineCore::LiveSpawnKind::Trap:
+		{
+			//Snapshots restore trap positions, the saved ones shift too so a restart keeps the move
+			int index = m_TrapManager.Move(from, to);
+			moved = index >= 0;
+			for (EngineGame::SceneSnapshot* snapshot : { &m_LevelStart, &m_Checkpoint })
+			{
+				if (moved && snapshot->valid && uint32_t(index) < snapshot->trapCount)
+				{
+					snapshot->traps[index].position += to - from;
+					snapshot->traps[index].collider.Translate(to - from);
+				}
+			}
+			break;
+		}
+		}
+
+		if (!moved)
+		{
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Warning,
+				EngineCore::LogCategory::Scene,
+				"Live link found nothing placed at " + std::to_string(move.from.x) + "," + std::to_string(move.from.y)
+			);
+		}
+	}
+
+	void Scene::ReloadMap(const std::vector<std::string>& paths)
+	{
+		const EngineData::LevelData* level = m_Context.GetLevels().GetCurrentLevel();
+		if (!level || !m_TileMap)
+			return;
+
+		std::string mapPath = EngineCore::GetFile("Maps", level->mapId);
+		bool edited = false;
+		for (const auto& path : paths)
+		{
+			std::error_code error;
+			edited |= std::filesystem::equivalent(path, mapPath + ".json", error);
+		}
+
+		if (!edited)
+			return;
+
+		if (m_TileMap->IsChunked())
+		{
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Warning,
+				EngineCore::LogCategory::Scene,
+				"Streamed levels play the cooked world, run TTCook world to apply the edit : " + mapPath
+			);
+			return;
+		}
+
+		EngineData::MapData map;
+		if (!EngineGame::MapLoader::LoadFromFile(mapPath, map))
+			return;
+
+		//Entities hold the tile map, so only a same sized grid is swapped in place
+		if (map.w != m_TileMap->GetWidth() || map.h != m_TileMap->GetHeight() || map.tSize != m_TileMap->GetTileSize())
+		{
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Warning,
+				EngineCore::LogCategory::Scene,
+				"Map size changed, restart the level to apply it : " + mapPath
+			);
+			return;
+		}
+
+		m_TileMap->SetTiles(map.tiles.GetData(), map.tiles.GetSize());
+		m_MapData.tiles = std::move(map.tiles);
+
+		EngineCore::Log::Write(
+			EngineCore::LogLevel::Info,
+			EngineCore::LogCategory::Scene,
+			"Map tiles reloaded, spawn edits apply on the next level load : " + mapPath
+		);
+	}
+
 	LoadContext Scene::GetLoadContext()
 	{
 		return LoadContext(
+			m_Context,
+			m_LevelArena,
 			m_Player,
 			m_Enemies,
 			m_TileMap,
@@ -240,6 +607,7 @@ namespace EnginePlatform
 			m_InteractableManager,
 			m_TrapManager,
 			m_Camera,
+			m_World,
 			m_PlayerSpawned,
 			m_LevelCompleted
 		);
@@ -3,27 +3,46 @@
 #include "Game/MapLoader.h"
 #include "Platform/HUD.h"
 #include "Platform/Loader.h"
+#include "Platform/WorldStreamer.h"
 #include "Game/InteractableManager.h"
 #include "Game/TrapManager.h"
+#include "Platform/HotReload.h"
+#include "Platform/LiveLink.h"
+#include "Game/Snapshot.h"
+#include "Platform/EngineContext.h"
 
 namespace EnginePlatform
 {
 	class Scene
 	{
 	public:
-		Scene();
+		explicit Scene(EngineContext& context);
 		
 		//Loading Objects
 		void Load();
+		void LoadDefinitions();			//Any thread, before Load
+		void PrefetchCurrentLevel();	//Any thread, after the levels list is loaded
 		
-		void Update(float dt);
+		void Update(float dt);			//UpdateLoading then Simulate
+		void UpdateLoading();			//Once per rendered frame
+		void Simulate(float dt);		//Game logic of one frame, rollback netplay runs frames again
 		void Render(EngineCore::IRenderer* renderer);
 		void ChangeGameState(GameState newState);
-		GameState GetGameState() { return m_GameState; }
+		GameState GetGameState() const { return m_GameState; }
 
 		//Level
 		void LoadCurrentLevel();
 		void OnLevelCompleted();
+		void RestartLevel();	//Death screen, restores a snapshot instead of reloading
+
+		//Rollback netplay, a frame of play saved here can be taken back even past a death or the level's end.
+		//The checkpoint goes with it, an interaction on a guessed frame may never have happened.
+		bool SaveFrame(EngineGame::SceneSnapshot& out, EngineGame::SceneSnapshot& outCheckpoint) const;
+		bool LoadFrame(const EngineGame::SceneSnapshot& frame, const EngineGame::SceneSnapshot& checkpoint, int levelIndex);
+
+		//Hot reload, patches live objects without restarting the level
+		void ApplyReload(const ReloadSet& reloaded);
+		void ApplyLiveEdits(const LiveEdits& edits);	//Editor live link, same frame slot as hot reload
 
 		//UI Methods
 		void StartGame();
@@ -32,13 +51,23 @@ namespace EnginePlatform
 		//Get Methods
 		LoadContext GetLoadContext();
 		EngineGame::Player& GetPlayer() { return m_Player; }
+		const EngineGame::Player& GetPlayer() const { return m_Player; }
+		bool IsLevelCompleted() const { return m_LevelCompleted; }
+		int GetLevelIndex() const { return m_Context.GetLevels().GetCurrentIndex(); }
 
 	private:
 		void UpdatePlaying(float dt);
 		void UpdateLevelComplete(float dt);
+		void ReloadMap(const std::vector<std::string>& paths);
+		void ApplyMapEdit(const LiveMapEdit& edit);
+		void MoveSpawn(const LiveSpawnMove& move);
+		bool SaveSnapshot(EngineGame::SceneSnapshot& out, bool warn = true) const;
+		bool RestoreSnapshot(const EngineGame::SceneSnapshot& snapshot);
 	private:
+		EngineContext& m_Context;
+		EngineGame::LevelArena m_LevelArena;	//Outlives everything a level spawns into it
 		EngineGame::Player m_Player;
-		std::vector<std::unique_ptr<EngineGame::Enemy>> m_Enemies;
+		EngineGame::LevelList<EngineGame::Enemy> m_Enemies;
 		EngineGame::Camera2D m_Camera;
 		std::unique_ptr<EngineGame::TileMap> m_TileMap;
 		GameState m_GameState = GameState::MainMenu;
@@ -55,9 +84,15 @@ namespace EnginePlatform
 		float m_LevelTextScale = 0.0f;
 		float m_LevelTextTimer = 0.0f;
 
+		//Snapshots, taken at level start, at checkpoints and on quick save
+		EngineGame::SceneSnapshot m_LevelStart;
+		EngineGame::SceneSnapshot m_Checkpoint;
+		EngineGame::SceneSnapshot m_QuickSave;
+
 		//HUD - Loader - Managers
 		HUD m_HUD;
 		Loader m_Loader;
+		WorldStreamer m_World;
 		EngineGame::InteractableManager m_InteractableManager;
 		EngineGame::TrapManager m_TrapManager;
 	};
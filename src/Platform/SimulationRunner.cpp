@@ -0,0 +1,209 @@
+#include "Platform/SimulationRunner.h"
+#include "Platform/Scene.h"
+#include "Platform/EngineContext.h"
+#include "Platform/LevelManager.h"
+#include "Platform/Loader.h"
+#include "Core/PathUtil.h"
+#include "Core/FileSystem.h"
+#include "Core/JobSystem.h"
+#include "Core/AsyncIO.h"
+#include "Core/Log.h"
+#include <SDL3/SDL.h>
+#include <thread>
+#include <atomic>
+#include <random>
+#include <algorithm>
+
+namespace EnginePlatform
+{
+	class RandomDriver : public SimulationDriver
+	{
+	public:
+		explicit RandomDriver(uint32_t seed) : m_Random(seed) {}
+
+		void Tick(float time, const Scene&, EngineCore::InputState& input) override
+		{
+			//A new heading every few seconds, mostly towards the end of the level
+			if (time >= m_NextTurn)
+			{
+				m_Right = Chance(0.75f);
+				m_NextTurn = time + 1.0f + 2.0f * m_Uniform(m_Random);
+			}
+
+			Hold(input, EngineCore::KeyCode::D, m_Right);
+			Hold(input, EngineCore::KeyCode::A, !m_Right);
+			Hold(input, EngineCore::KeyCode::W, Chance(0.08f));
+			Hold(input, EngineCore::KeyCode::E, Chance(0.05f));
+			Hold(input, EngineCore::KeyCode::F5, Chance(0.05f));
+		}
+	private:
+		bool Chance(float probability) { return m_Uniform(m_Random) < probability; }
+
+		static void Hold(EngineCore::InputState& input, EngineCore::KeyCode key, bool down)
+		{
+			if (input.IsKeyDown(key) != down)
+				input.SetKey(key, down);
+		}
+
+		std::mt19937 m_Random;
+		std::uniform_real_distribution<float> m_Uniform{ 0.0f, 1.0f };
+		float m_NextTurn = 0.0f;
+		bool m_Right = true;
+	};
+
+	std::unique_ptr<SimulationDriver> SimulationRunner::CreateRandomDriver(uint32_t seed)
+	{
+		return std::make_unique<RandomDriver>(seed);
+	}
+
+	bool SimulationRunner::Init()
+	{
+		EngineCore::Log::Init();
+		EngineCore::FileSystem::Init();
+		EngineCore::JobSystem::Init();
+		EngineCore::AsyncIO::Init();
+
+		//Shared by every instance, read only once the runs start
+		Loader loader;
+		loader.LoadBasics();
+		return LevelManager::LoadAllLevels(EngineCore::GetFile("Data", "Levels.json"));
+	}
+
+	void SimulationRunner::Shutdown()
+	{
+		EngineCore::JobSystem::Shutdown();
+		EngineCore::FileSystem::Shutdown();
+	}
+
+	std::vector<SimulationResult> SimulationRunner::Run(const SimulationSettings& settings, const SimulationDriverFactory& createDriver)
+	{
+		std::vector<SimulationResult> results(std::max(settings.playthroughs, 0));
+		if (results.empty())
+			return results;
+
+		//Plain threads rather than jobs, a level load waits on a job and would starve with every worker simulating
+		unsigned int threads = settings.threads > 0 ? (unsigned int)settings.threads : std::max(1u, std::thread::hardware_concurrency());
+		threads = std::min<unsigned int>(threads, (unsigned int)results.size());
+
+		std::atomic<size_t> next = 0;
+		auto work = [&]()
+		{
+			for (size_t i = next.fetch_add(1); i < results.size(); i = next.fetch_add(1))
+			{
+				std::unique_ptr<SimulationDriver> driver = createDriver((int)i);
+				results[i] = RunOne((int)i, settings, *driver);
+			}
+		};
+
+		Uint64 start = SDL_GetPerformanceCounter();
+
+		std::vector<std::thread> pool;
+		for (unsigned int t = 1; t < threads; t++)
+			pool.emplace_back(work);
+		work();
+		for (auto& thread : pool)
+			thread.join();
+
+		double elapsedMs = (SDL_GetPerformanceCounter() - start) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+		EngineCore::Log::Write(
+			EngineCore::LogLevel::Info,
+			EngineCore::LogCategory::Scene,
+			"Simulated " + std::to_string(results.size()) + " playthroughs on " + std::to_string(threads) +
+			" threads in " + std::to_string(elapsedMs) + " ms"
+		);
+
+		return results;
+	}
+
+	SimulationResult SimulationRunner::RunOne(int playthrough, const SimulationSettings& settings, SimulationDriver& driver)
+	{
+		EngineCore::InputState input;
+		EngineContext context(input, true);
+		Scene scene(context);
+		scene.Load();
+
+		SimulationResult result;
+		result.playthrough = playthrough;
+
+		context.GetLevels().StartLevelByIndex(settings.startLevel);
+		if (!context.GetLevels().GetCurrentLevel())
+			return result;
+
+		scene.LoadCurrentLevel();
+		scene.ChangeGameState(GameState::Playing);
+
+		GameState previous = GameState::Playing;
+		while (result.seconds < settings.maxSeconds)
+		{
+			driver.Tick(result.seconds, scene, input);
+			scene.Update(settings.fixedDt);
+			input.EndFrame();
+			result.seconds += settings.fixedDt;
+
+			GameState state = scene.GetGameState();
+			if (state == GameState::DeathScreen)
+			{
+				//The death screen waits for a click, a simulation restarts straight away
+				result.deaths++;
+				scene.RestartLevel();
+				previous = scene.GetGameState();
+				continue;
+			}
+
+			//Leaving play for the transition or the menu means the level was completed
+			if (previous == GameState::Playing && state != GameState::Playing)
+				result.levelsCompleted++;
+
+			if (state == GameState::MainMenu)
+			{
+				result.finished = true;
+				break;
+			}
+
+			previous = state;
+		}
+
+		return result;
+	}
+
+	bool SimulationRunner::RunHeadless(const SimulationSettings& settings)
+	{
+		if (!Init())
+		{
+			Shutdown();
+			return false;
+		}
+
+		std::vector<SimulationResult> results = Run(settings, [&settings](int playthrough)
+		{
+			return CreateRandomDriver(settings.seed + (uint32_t)playthrough);
+		});
+
+		int finished = 0;
+		int levels = 0;
+		int deaths = 0;
+		for (const auto& result : results)
+		{
+			finished += result.finished ? 1 : 0;
+			levels += result.levelsCompleted;
+			deaths += result.deaths;
+
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Trace,
+				EngineCore::LogCategory::Scene,
+				"Playthrough " + std::to_string(result.playthrough) + " : " + std::to_string(result.levelsCompleted) + " levels, " +
+				std::to_string(result.deaths) + " deaths, " + std::to_string(result.seconds) + " s"
+			);
+		}
+
+		EngineCore::Log::Write(
+			EngineCore::LogLevel::Info,
+			EngineCore::LogCategory::Scene,
+			"Simulation summary : " + std::to_string(finished) + "/" + std::to_string(results.size()) + " finished, " +
+			std::to_string(levels) + " levels completed, " + std::to_string(deaths) + " deaths"
+		);
+
+		Shutdown();
+		return true;
+	}
+}
\ No newline at end of file
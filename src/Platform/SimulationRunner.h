@@ -0,0 +1,61 @@
+#pragma once
+#include <vector>
+#include <memory>
+#include <functional>
+#include <cstdint>
+#include "Core/Input.h"
+
+namespace EnginePlatform
+{
+	class Scene;
+
+	struct SimulationSettings
+	{
+		int playthroughs = 1;
+		int threads = 0;				//0 = one per hardware thread
+		int startLevel = 0;
+		float fixedDt = 1.0f / 60.0f;
+		float maxSeconds = 120.0f;		//Simulated time each playthrough is allowed
+		uint32_t seed = 1;
+	};
+
+	struct SimulationResult
+	{
+		int playthrough = 0;
+		int levelsCompleted = 0;
+		int deaths = 0;
+		float seconds = 0.0f;			//Simulated
+		bool finished = false;			//Every level from the start one was completed
+	};
+
+	//Plays one playthrough, created on and only used by the thread running it
+	class SimulationDriver
+	{
+	public:
+		virtual ~SimulationDriver() = default;
+
+		//Before every tick, what is written into input is what the player reads this frame
+		virtual void Tick(float time, const Scene& scene, EngineCore::InputState& input) = 0;
+	};
+
+	using SimulationDriverFactory = std::function<std::unique_ptr<SimulationDriver>(int playthrough)>;
+
+	//Headless games at a fixed step, one Scene per playthrough and several running at once on their own threads
+	class SimulationRunner
+	{
+	public:
+		//Process setup without a window, file system, workers, definitions and the level list
+		static bool Init();
+		static void Shutdown();
+
+		static std::vector<SimulationResult> Run(const SimulationSettings& settings, const SimulationDriverFactory& createDriver);
+
+		//Init, random playthroughs, a summary in the log and Shutdown, false when setup failed
+		static bool RunHeadless(const SimulationSettings& settings);
+
+		//Walks, jumps, attacks and interacts at random, seeded so a run can be repeated
+		static std::unique_ptr<SimulationDriver> CreateRandomDriver(uint32_t seed);
+	private:
+		static SimulationResult RunOne(int playthrough, const SimulationSettings& settings, SimulationDriver& driver);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,152 @@
+#include "Platform/TextureCache.h"
+#include "Core/PathUtil.h"
+#include "Core/Log.h"
+#include "Core/Hash.h"
+#include "Core/FileSystem.h"
+#include <fstream>
+#include <cstdio>
+
+namespace EnginePlatform
+{
+	constexpr uint32_t CACHE_MAGIC = 0x43545454;	//"TTTC"
+	constexpr uint32_t CACHE_VERSION = 1;
+	constexpr size_t PIXEL_OFFSET = 64;				//Keeps the pixel rows 64 byte aligned in the mapping
+
+	std::filesystem::path TextureCache::s_Directory;
+	SDL_PixelFormat TextureCache::s_Format = SDL_PIXELFORMAT_ARGB8888;
+
+	void TextureCache::Init(SDL_Renderer* renderer)
+	{
+		static_assert(sizeof(Header) <= PIXEL_OFFSET, "Cache header overlaps pixel data");
+
+		//First alpha capable format the renderer lists is the one it uploads without converting
+		const SDL_PixelFormat* formats = static_cast<const SDL_PixelFormat*>(SDL_GetPointerProperty(
+			SDL_GetRendererProperties(renderer), SDL_PROP_RENDERER_TEXTURE_FORMATS_POINTER, nullptr));
+
+		if (formats)
+		{
+			for (int i = 0; formats[i] != SDL_PIXELFORMAT_UNKNOWN; i++)
+			{
+				if (SDL_ISPIXELFORMAT_ALPHA(formats[i]) && !SDL_ISPIXELFORMAT_FOURCC(formats[i]))
+				{
+					s_Format = formats[i];
+					break;
+				}
+			}
+		}
+
+		s_Directory = std::filesystem::path(EngineCore::GetExecutableDirectory()) / "Cache" / "Textures";
+
+		std::error_code error;
+		std::filesystem::create_directories(s_Directory, error);
+		if (error)
+		{
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Warning,
+				EngineCore::LogCategory::Renderer,
+				"Texture cache directory could not be created : " + s_Directory.string()
+			);
+		}
+	}
+
+	bool TextureCache::Load(const std::string& sourcePath, CachedSurface& outSurface)
+	{
+		uint64_t sourceSize;
+		int64_t sourceTime;
+		if (!GetSourceStamp(sourcePath, sourceSize, sourceTime))
+			return false;
+
+		uint64_t pathHash = EngineCore::HashFnv1a64(sourcePath);
+
+		auto mapping = std::make_shared<EngineCore::MappedFile>();
+		if (!mapping->Open(GetCachePath(pathHash).string()) || mapping->GetSize() < PIXEL_OFFSET)
+			return false;
+
+		//Any mismatch means the entry is stale, the caller decodes and stores it again
+		const Header* header = reinterpret_cast<const Header*>(mapping->GetData());
+		if (header->magic != CACHE_MAGIC || header->version != CACHE_VERSION ||
+			header->format != static_cast<uint32_t>(s_Format) || header->pathHash != pathHash ||
+			header->sourceSize != sourceSize || header->sourceTime != sourceTime)
+			return false;
+
+		size_t pixelBytes = static_cast<size_t>(header->pitch) * header->height;
+		if (header->width <= 0 || header->height <= 0 || mapping->GetSize() < PIXEL_OFFSET + pixelBytes)
+			return false;
+
+		void* pixels = const_cast<uint8_t*>(mapping->GetData() + PIXEL_OFFSET);
+		SDL_Surface* surface = SDL_CreateSurfaceFrom(header->width, header->height, s_Format, pixels, header->pitch);
+		if (!surface)
+			return false;
+
+		outSurface.surface = surface;
+		outSurface.mapping = std::move(mapping);
+		return true;
+	}
+
+	SDL_Surface* TextureCache::Store(const std::string& sourcePath, SDL_Surface* decoded)
+	{
+		if (!decoded)
+			return nullptr;
+
+		SDL_Surface* converted = decoded->format == s_Format ? decoded : SDL_ConvertSurface(decoded, s_Format);
+		if (!converted)
+			return decoded;
+
+		if (converted != decoded)
+			SDL_DestroySurface(decoded);
+
+		uint64_t sourceSize;
+		int64_t sourceTime;
+		if (!GetSourceStamp(sourcePath, sourceSize, sourceTime))
+			return converted;
+
+		Header header{};
+		header.magic = CACHE_MAGIC;
+		header.version = CACHE_VERSION;
+		header.format = static_cast<uint32_t>(s_Format);
+		header.width = converted->w;
+		header.height = converted->h;
+		header.pitch = converted->pitch;
+		header.pathHash = EngineCore::HashFnv1a64(sourcePath);
+		header.sourceSize = sourceSize;
+		header.sourceTime = sourceTime;
+
+		std::filesystem::path target = GetCachePath(header.pathHash);
+		std::filesystem::path temp = target;
+		temp += ".tmp";
+
+		//Written aside and renamed so a crash never leaves a half written entry
+		{
+			std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+			if (!file)
+				return converted;
+
+			char padding[PIXEL_OFFSET] = {};
+			file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+			file.write(padding, PIXEL_OFFSET - sizeof(Header));
+			file.write(static_cast<const char*>(converted->pixels), static_cast<std::streamsize>(converted->pitch) * converted->h);
+
+			if (!file)
+				return converted;
+		}
+
+		std::error_code error;
+		std::filesystem::rename(temp, target, error);
+		if (error)
+			std::filesystem::remove(temp, error);
+
+		return converted;
+	}
+
+	std::filesystem::path TextureCache::GetCachePath(uint64_t pathHash)
+	{
+		char name[32];
+		std::snprintf(name, sizeof(name), "%016llx.ttc", static_cast<unsigned long long>(pathHash));
+		return s_Directory / name;
+	}
+
+	bool TextureCache::GetSourceStamp(const std::string& sourcePath, uint64_t& outSize, int64_t& outTime)
+	{
+		return EngineCore::FileSystem::GetStamp(sourcePath, outSize, outTime);
+	}
+}
\ No newline at end of file
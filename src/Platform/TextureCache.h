@@ -0,0 +1,48 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <string>
+#include <memory>
+#include <filesystem>
+#include "Core/MappedFile.h"
+
+namespace EnginePlatform
+{
+	//Surface whose pixels live inside a mapped cache file, the mapping must outlive the surface
+	struct CachedSurface
+	{
+		SDL_Surface* surface = nullptr;
+		std::shared_ptr<EngineCore::MappedFile> mapping;
+	};
+
+	//On-disk cache of decoded textures in the renderer's native pixel format
+	class TextureCache
+	{
+	public:
+		static void Init(SDL_Renderer* renderer);
+
+		//Worker safe
+		static bool Load(const std::string& sourcePath, CachedSurface& outSurface);
+		static SDL_Surface* Store(const std::string& sourcePath, SDL_Surface* decoded);	//Takes ownership, returns the converted surface
+
+		static SDL_PixelFormat GetFormat() { return s_Format; }
+	private:
+		struct Header
+		{
+			uint32_t magic;
+			uint32_t version;
+			uint32_t format;
+			int32_t width;
+			int32_t height;
+			int32_t pitch;
+			uint64_t pathHash;
+			uint64_t sourceSize;
+			int64_t sourceTime;
+		};
+
+		static std::filesystem::path GetCachePath(uint64_t pathHash);
+		static bool GetSourceStamp(const std::string& sourcePath, uint64_t& outSize, int64_t& outTime);
+
+		static std::filesystem::path s_Directory;
+		static SDL_PixelFormat s_Format;
+	};
+}
\ No newline at end of file
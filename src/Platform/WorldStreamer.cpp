@@ -0,0 +1,229 @@
+#include "Platform/WorldStreamer.h"
+#include "Platform/LoadContext.h"
+#include "Platform/Loader.h"
+#include "Platform/LibraryManager.h"
+#include "Game/Player.h"
+#include "Game/Enemy.h"
+#include "Game/TileMap.h"
+#include "Game/InteractableManager.h"
+#include "Game/TrapManager.h"
+#include "Core/JobSystem.h"
+#include "Core/Log.h"
+#include <algorithm>
+#include <cmath>
+
+namespace EnginePlatform
+{
+	//Same view the camera and TileMap::Draw use
+	static constexpr float VIEW_WIDTH = 800.0f;
+	static constexpr float VIEW_HEIGHT = 600.0f;
+
+	void WorldStreamer::Begin(std::shared_ptr<const EngineGame::WorldFile> world, LoadContext& ctx)
+	{
+		Close();
+
+		m_World = std::move(world);
+		m_Finished = std::make_shared<FinishedReads>();
+		m_Chunks.assign(size_t(m_World->GetChunksX()) * m_World->GetChunksY(), ChunkState::Unloaded);
+
+		//Read in place, the first frame must not see walls where the player stands
+		int x0, y0, x1, y1;
+		GetRange(ctx.player.GetPosition(), LOAD_MARGIN, x0, y0, x1, y1);
+		for (int y = y0; y <= y1; y++)
+		{
+			for (int x = x0; x <= x1; x++)
+			{
+				EngineGame::ChunkData chunk;
+				if (!m_World->ReadChunk(x, y, chunk))
+				{
+					chunk.x = x;
+					chunk.y = y;
+				}
+
+				m_Chunks[size_t(y) * m_World->GetChunksX() + x] = ChunkState::Pending;
+				Install(ctx, chunk);
+			}
+		}
+
+		EngineCore::Log::Write(
+			EngineCore::LogLevel::Info,
+			EngineCore::LogCategory::Scene,
+			"World streaming started, " + std::to_string(m_Resident.size()) + " chunks resident, snapshots are off for this level"
+		);
+	}
+
+	void WorldStreamer::Close()
+	{
+		m_World.reset();
+		m_Finished.reset();
+		m_Chunks.clear();
+		m_Resident.clear();
+		m_Saved.clear();
+	}
+
+	void WorldStreamer::Update(LoadContext& ctx, const EngineMath::Vector2& focus)
+	{
+		if (!m_World)
+			return;
+
+		std::vector<EngineGame::ChunkData> finished;
+		{
+			std::lock_guard<std::mutex> lock(m_Finished->mutex);
+			finished.swap(m_Finished->chunks);
+		}
+
+		for (const auto& chunk : finished)
+			Install(ctx, chunk);
+
+		//Drop what fell behind, then ask for what is coming into view
+		int x0, y0, x1, y1;
+		GetRange(focus, EVICT_MARGIN, x0, y0, x1, y1);
+		for (size_t i = 0; i < m_Resident.size();)
+		{
+			int chunkX = m_Resident[i] % m_World->GetChunksX();
+			int chunkY = m_Resident[i] / m_World->GetChunksX();
+			if (chunkX >= x0 && chunkX <= x1 && chunkY >= y0 && chunkY <= y1)
+			{
+				i++;
+				continue;
+			}
+
+			Evict(ctx, chunkX, chunkY);
+			m_Resident[i] = m_Resident.back();
+			m_Resident.pop_back();
+		}
+
+		GetRange(focus, LOAD_MARGIN, x0, y0, x1, y1);
+		for (int y = y0; y <= y1; y++)
+		{
+			for (int x = x0; x <= x1; x++)
+			{
+				if (m_Chunks[size_t(y) * m_World->GetChunksX() + x] == ChunkState::Unloaded)
+					Request(x, y);
+			}
+		}
+	}
+
+	void WorldStreamer::GetRange(const EngineMath::Vector2& focus, int margin, int& outX0, int& outY0, int& outX1, int& outY1) const
+	{
+		float chunkPixels = float(m_World->GetChunkSize() * m_World->GetTileSize());
+
+		outX0 = std::max(0, int(std::floor((focus.x - VIEW_WIDTH * 0.5f) / chunkPixels)) - margin);
+		outY0 = std::max(0, int(std::floor((focus.y - VIEW_HEIGHT * 0.5f) / chunkPixels)) - margin);
+		outX1 = std::min(m_World->GetChunksX() - 1, int(std::floor((focus.x + VIEW_WIDTH * 0.5f) / chunkPixels)) + margin);
+		outY1 = std::min(m_World->GetChunksY() - 1, int(std::floor((focus.y + VIEW_HEIGHT * 0.5f) / chunkPixels)) + margin);
+	}
+
+	void WorldStreamer::Request(int chunkX, int chunkY)
+	{
+		m_Chunks[size_t(chunkY) * m_World->GetChunksX() + chunkX] = ChunkState::Pending;
+
+		//The job keeps the mapped file alive even if the level changes before it runs
+		auto job = [world = m_World, finished = m_Finished, chunkX, chunkY]()
+		{
+			EngineGame::ChunkData chunk;
+			if (!world->ReadChunk(chunkX, chunkY, chunk))
+			{
+				chunk.x = chunkX;
+				chunk.y = chunkY;
+				chunk.tiles.clear();
+			}
+
+			std::lock_guard<std::mutex> lock(finished->mutex);
+			finished->chunks.push_back(std::move(chunk));
+		};
+
+		if (EngineCore::JobSystem::GetWorkerCount() > 0)
+			EngineCore::JobSystem::Submit(job);
+		else
+			job();
+	}
+
+	void WorldStreamer::Install(LoadContext& ctx, const EngineGame::ChunkData& chunk)
+	{
+		int index = chunk.y * m_World->GetChunksX() + chunk.x;
+		if (m_Chunks[index] != ChunkState::Pending)
+			return;
+
+		//A chunk that failed to read stays solid and is not asked for again
+		m_Chunks[index] = ChunkState::Resident;
+		m_Resident.push_back(index);
+
+		if (chunk.tiles.size() != size_t(m_World->GetChunkSize()) * m_World->GetChunkSize())
+		{
+			EngineCore::Log::Write(
+				EngineCore::LogLevel::Error,
+				EngineCore::LogCategory::Scene,
+				"World chunk " + std::to_string(chunk.x) + "," + std::to_string(chunk.y) + " could not be read, it stays solid"
+			);
+			return;
+		}
+
+		ctx.tileMap->SetChunk(chunk.x, chunk.y, chunk.tiles.data());
+
+		//Chunks seen before come back as they were left
+		auto saved = m_Saved.find(index);
+		if (saved == m_Saved.end())
+		{
+			for (const auto& spawn : chunk.enemies)
+				Loader::SpawnEnemy(ctx, spawn);
+			for (const auto& spawn : chunk.interactables)
+				Loader::SpawnInteractable(ctx, spawn);
+			for (const auto& spawn : chunk.traps)
+				Loader::SpawnTrap(ctx, spawn);
+			return;
+		}
+
+		for (const auto& enemy : saved->second.enemies)
+		{
+			const EngineData::EntityData* def = EntityLibrary::Get(enemy.definition);
+			if (!def)
+				continue;
+
+			auto spawned = ctx.levelArena.Create<EngineGame::Enemy>();
+			spawned->SetWorld(ctx.tileMap.get());
+			spawned->ApplyDefinition(*def);
+			spawned->LoadState(enemy.state);
+			ctx.enemies.push_back(std::move(spawned));
+		}
+
+		for (const auto& interactable : saved->second.interactables)
+			ctx.interactableList.Restore(interactable);
+		for (const auto& trap : saved->second.traps)
+			ctx.trapList.Restore(trap);
+
+		m_Saved.erase(saved);
+	}
+
+	void WorldStreamer::Evict(LoadContext& ctx, int chunkX, int chunkY)
+	{
+		int index = chunkY * m_World->GetChunksX() + chunkX;
+		float chunkPixels = float(m_World->GetChunkSize() * m_World->GetTileSize());
+
+		EngineCore::AABB area;
+		area.SetFromPositionSize(chunkX * chunkPixels, chunkY * chunkPixels, chunkPixels, chunkPixels);
+
+		//Always stored, an empty entry is what keeps killed enemies from spawning again
+		SavedChunk& saved = m_Saved[index];
+		std::erase_if(ctx.enemies, [&](const EngineGame::LevelPtr<EngineGame::Enemy>& enemy)
+		{
+			EngineMath::Vector2 pos = enemy->GetPosition();
+			if (pos.x < area.minX || pos.x >= area.maxX || pos.y < area.minY || pos.y >= area.maxY)
+				return false;
+
+			if (!enemy->IsDead())
+			{
+				EngineGame::SavedEnemy& entry = saved.enemies.emplace_back();
+				entry.definition = enemy->GetDefinitionKey();
+				enemy->SaveState(entry.state);
+			}
+			return true;
+		});
+
+		ctx.interactableList.Evict(area, saved.interactables);
+		ctx.trapList.Evict(area, saved.traps);
+
+		ctx.tileMap->ClearChunk(chunkX, chunkY);
+		m_Chunks[index] = ChunkState::Unloaded;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+#pragma once
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include "Core/Math/Vector2.h"
+#include "Game/WorldFile.h"
+#include "Game/Snapshot.h"
+
+namespace EnginePlatform
+{
+	struct LoadContext;
+
+	//Keeps the chunks around the player resident in a chunked TileMap. Chunks are read on the job system,
+	//their objects are spawned when they come in and saved when they are dropped
+	class WorldStreamer
+	{
+	public:
+		static constexpr int LOAD_MARGIN = 1;	//Chunks past the view that are requested
+		static constexpr int EVICT_MARGIN = 2;	//Chunks past the view that are kept, the gap stops thrashing at a border
+
+		//Reads the chunks around the spawned player before the first frame
+		void Begin(std::shared_ptr<const EngineGame::WorldFile> world, LoadContext& ctx);
+		void Close();
+		bool IsOpen() const { return m_World != nullptr; }
+
+		void Update(LoadContext& ctx, const EngineMath::Vector2& focus);	//Main thread every frame
+	private:
+		enum class ChunkState : uint8_t
+		{
+			Unloaded,
+			Pending,
+			Resident
+		};
+
+		//Objects of an evicted chunk, restored instead of the file spawns when it comes back
+		struct SavedChunk
+		{
+			std::vector<EngineGame::SavedEnemy> enemies;
+			std::vector<EngineGame::SavedInteractable> interactables;
+			std::vector<EngineGame::SavedTrap> traps;
+		};
+
+		//Filled by jobs, a level change swaps in a new one so late reads land nowhere
+		struct FinishedReads
+		{
+			std::mutex mutex;
+			std::vector<EngineGame::ChunkData> chunks;
+		};
+
+		void GetRange(const EngineMath::Vector2& focus, int margin, int& outX0, int& outY0, int& outX1, int& outY1) const;
+		void Request(int chunkX, int chunkY);
+		void Install(LoadContext& ctx, const EngineGame::ChunkData& chunk);
+		void Evict(LoadContext& ctx, int chunkX, int chunkY);
+
+		std::shared_ptr<const EngineGame::WorldFile> m_World;
+		std::shared_ptr<FinishedReads> m_Finished;
+		std::vector<ChunkState> m_Chunks;		//Row major like the world file
+		std::vector<int> m_Resident;			//Chunk indices, only these are checked for eviction
+		std::unordered_map<int, SavedChunk> m_Saved;
+	};
+}
\ No newline at end of file
@@ -1,9 +1,43 @@
 #include "Core/Application.h"
 #include "Core/Log.h"
+#include "Platform/SimulationRunner.h"
+#include <string>
+#include <cstdlib>
+#include <utility>
 
 int main(int argc, char** argv)
 {
-    EngineCore::Application app;
+    //Headless balancing runs, no window : --simulate <playthroughs> [threads] [seconds]
+    if (argc > 1 && std::string(argv[1]) == "--simulate")
+    {
+        EnginePlatform::SimulationSettings settings;
+        settings.playthroughs = argc > 2 ? std::atoi(argv[2]) : 1;
+        settings.threads = argc > 3 ? std::atoi(argv[3]) : 0;
+        if (argc > 4)
+            settings.maxSeconds = (float)std::atof(argv[4]);
+
+        return EnginePlatform::SimulationRunner::RunHeadless(settings) ? 0 : 1;
+    }
+
+    //Two windows on one machine : --netplay <0|1> [localPort peerPort [peerHost]]
+    EnginePlatform::NetplaySettings netplay;
+    if (argc > 1 && std::string(argv[1]) == "--netplay")
+    {
+        netplay.enabled = true;
+        netplay.player = argc > 2 ? std::atoi(argv[2]) : 0;
+        if (netplay.player == 1)
+            std::swap(netplay.localPort, netplay.peerPort);
+
+        if (argc > 4)
+        {
+            netplay.localPort = (uint16_t)std::atoi(argv[3]);
+            netplay.peerPort = (uint16_t)std::atoi(argv[4]);
+        }
+        if (argc > 5)
+            netplay.peerHost = argv[5];
+    }
+
+    EngineCore::Application app(netplay);
 
     /*
     EngineCore::Log::Write(
@@ -0,0 +1,84 @@
+#include "DefsCooker.h"
+#include "Core/Data/DefinitionWriter.h"
+#include "RecordFile.h"
+#include "Core/Data/Animation/AnimationParser.h"
+#include "Core/Data/Entity/EntityParser.h"
+#include "Core/Data/Interactable/InteractableParser.h"
+#include "Core/Data/Interactable/TrapParser.h"
+#include <fstream>
+#include <iostream>
+#include <syncstream>
+#include <algorithm>
+#include <vector>
+
+namespace TTCook
+{
+	//Same rules as DataLibrary: empty ids dropped, sorted by id, last duplicate wins
+	template<typename T, typename Parser>
+	static void AddSection(std::vector<T> items, EngineData::DefinitionWriter& writer)
+	{
+		std::erase_if(items, [](const T& item) { return item.id.empty(); });
+		std::stable_sort(items.begin(), items.end(), [](const T& a, const T& b) { return a.id < b.id; });
+
+		std::vector<typename Parser::Record> records;
+		for (size_t i = 0; i < items.size(); i++)
+		{
+			if (i + 1 < items.size() && items[i + 1].id == items[i].id)
+				continue;
+
+			records.push_back(Parser::ToRecord(items[i], writer));
+		}
+
+		writer.AddSection(Parser::BLOB_TYPE, records);
+		std::osyncstream(std::cout) << "  " << records.size() << " records\n";
+	}
+
+	bool DefsCooker::Cook(const std::filesystem::path& assetsDir, const std::filesystem::path& output)
+	{
+		EngineData::DataArena arena;
+		EngineData::DefinitionWriter writer;
+
+		//Animations, one file each, in the order DataLibrary lists them
+		std::vector<std::filesystem::path> animFiles;
+		for (auto& file : std::filesystem::directory_iterator(assetsDir / "Animation"))
+		{
+			if (file.path().extension() == ".json")
+				animFiles.push_back(file.path());
+		}
+		std::sort(animFiles.begin(), animFiles.end());
+
+		std::vector<EngineData::AnimationData> animations;
+		for (const auto& file : animFiles)
+		{
+			if (!ReadRecords<EngineData::AnimationData, EngineData::AnimationParser>(file, arena, animations))
+				return false;
+		}
+
+		std::vector<EngineData::EntityData> entities;
+		std::vector<EngineData::InteractableData> interactables;
+		std::vector<EngineData::TrapData> traps;
+
+		std::filesystem::path dataDir = assetsDir / "Data";
+		if (!ReadRecords<EngineData::EntityData, EngineData::EntityParser>(dataDir / "entity_def.json", arena, entities) ||
+			!ReadRecords<EngineData::InteractableData, EngineData::InteractableParser>(dataDir / "Interactables.json", arena, interactables) ||
+			!ReadRecords<EngineData::TrapData, EngineData::TrapParser>(dataDir / "TrapDef.json", arena, traps))
+			return false;
+
+		std::osyncstream(std::cout) << "Animations\n";
+		AddSection<EngineData::AnimationData, EngineData::AnimationParser>(std::move(animations), writer);
+		std::osyncstream(std::cout) << "Entities\n";
+		AddSection<EngineData::EntityData, EngineData::EntityParser>(std::move(entities), writer);
+		std::osyncstream(std::cout) << "Interactables\n";
+		AddSection<EngineData::InteractableData, EngineData::InteractableParser>(std::move(interactables), writer);
+		std::osyncstream(std::cout) << "Traps\n";
+		AddSection<EngineData::TrapData, EngineData::TrapParser>(std::move(traps), writer);
+
+		std::vector<uint8_t> bytes = writer.Build();
+
+		if (!ReplaceFile(output, bytes))
+			return false;
+
+		std::osyncstream(std::cout) << "Wrote " << output.string() << " (" << bytes.size() << " bytes)\n";
+		return true;
+	}
+}
\ No newline at end of file
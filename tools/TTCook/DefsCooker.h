@@ -0,0 +1,12 @@
+#pragma once
+#include <filesystem>
+
+namespace TTCook
+{
+	//Every DataLibrary json under Assets into one .ttdefs blob
+	class DefsCooker
+	{
+	public:
+		static bool Cook(const std::filesystem::path& assetsDir, const std::filesystem::path& output);
+	};
+}
\ No newline at end of file
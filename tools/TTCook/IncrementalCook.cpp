@@ -0,0 +1,253 @@
+#include "IncrementalCook.h"
+#include "MapCooker.h"
+#include "DefsCooker.h"
+#include "Parallel.h"
+#include "Core/Hash.h"
+#include "Core/Data/DefinitionBlob.h"
+#include "Core/Data/Map/MapFormat.h"
+#include "Core/Data/Map/WorldFormat.h"
+#include <fstream>
+#include <iostream>
+#include <syncstream>
+#include <iomanip>
+#include <functional>
+#include <unordered_map>
+#include <algorithm>
+#include <iterator>
+#include <charconv>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace TTCook
+{
+	enum class TaskResult
+	{
+		UpToDate,
+		Cooked,
+		Failed
+	};
+
+	//One output and everything it is cooked from
+	struct CookTask
+	{
+		std::string key;		//Output relative to Assets, the manifest key
+		std::filesystem::path output;
+		std::vector<std::filesystem::path> inputs;
+		std::string format;		//Output format and version, a bump recooks everything of that kind
+		std::function<bool()> cook;
+
+		uint64_t hash = 0;
+		TaskResult result = TaskResult::Failed;
+	};
+
+	static std::string GetKey(const std::filesystem::path& assetsDir, const std::filesystem::path& path)
+	{
+		return std::filesystem::relative(path, assetsDir).generic_string();
+	}
+
+	static std::vector<std::filesystem::path> ListJson(const std::filesystem::path& folder)
+	{
+		std::vector<std::filesystem::path> files;
+		if (!std::filesystem::is_directory(folder))
+			return files;
+
+		for (auto& file : std::filesystem::directory_iterator(folder))
+		{
+			const auto& path = file.path();
+			if (file.is_regular_file() && path.extension() == ".json" && path.stem().extension() != ".deps")
+				files.push_back(path);
+		}
+
+		std::sort(files.begin(), files.end());
+		return files;
+	}
+
+	//Streamed levels are recooked with the chunk size they were first cooked with
+	static int ReadChunkSize(const std::filesystem::path& world)
+	{
+		std::ifstream file(world, std::ios::binary);
+		EngineData::WorldFileHeader header{};
+		if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.magic != EngineData::WORLD_MAGIC)
+			return 0;
+
+		return header.chunkSize;
+	}
+
+	static std::vector<CookTask> GatherTasks(const std::filesystem::path& assetsDir)
+	{
+		std::vector<CookTask> tasks;
+
+		for (const auto& map : ListJson(assetsDir / "Maps"))
+		{
+			std::filesystem::path output = map;
+			output.replace_extension(".ttmap");
+			tasks.push_back({ GetKey(assetsDir, output), output, { map }, "map " + std::to_string(EngineData::MAP_VERSION),
+				[map, output]() { return MapCooker::Cook(map, output); } });
+
+			std::filesystem::path world = map;
+			world.replace_extension(".ttworld");
+			int chunkSize = std::filesystem::exists(world) ? ReadChunkSize(world) : 0;
+			if (chunkSize > 0)
+			{
+				tasks.push_back({ GetKey(assetsDir, world), world, { map },
+					"world " + std::to_string(EngineData::WORLD_VERSION) + " " + std::to_string(chunkSize),
+					[map, world, chunkSize]() { return MapCooker::CookWorld(map, world, chunkSize); } });
+			}
+		}
+
+		//Every definition library goes into one blob, any of its files changing recooks it
+		std::vector<std::filesystem::path> definitions = ListJson(assetsDir / "Animation");
+		definitions.push_back(assetsDir / "Data" / "entity_def.json");
+		definitions.push_back(assetsDir / "Data" / "Interactables.json");
+		definitions.push_back(assetsDir / "Data" / "TrapDef.json");
+
+		std::filesystem::path blob = assetsDir / "Data" / EngineData::DEFINITIONS_FILE;
+		tasks.push_back({ GetKey(assetsDir, blob), blob, definitions, "defs " + std::to_string(EngineData::DEFS_VERSION),
+			[assetsDir, blob]() { return DefsCooker::Cook(assetsDir, blob); } });
+
+		return tasks;
+	}
+
+	//Hash of every input's path and bytes, false when one cannot be read
+	static bool HashInputs(const std::filesystem::path& assetsDir, CookTask& task)
+	{
+		std::string combined = task.format + "\n";
+		for (const auto& input : task.inputs)
+		{
+			std::ifstream file(input, std::ios::binary);
+			if (!file.is_open())
+			{
+				std::osyncstream(std::cerr) << "Cannot read: " << input.string() << "\n";
+				return false;
+			}
+
+			std::string bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+			combined += GetKey(assetsDir, input) + " " + std::to_string(EngineCore::HashFnv1a64(bytes)) + "\n";
+		}
+
+		task.hash = EngineCore::HashFnv1a64(combined);
+		return true;
+	}
+
+	//The engine checks freshness by write time, an input saved again unchanged would make the output look stale
+	static void TouchOutput(const CookTask& task)
+	{
+		std::error_code error;
+		auto outputTime = std::filesystem::last_write_time(task.output, error);
+		if (error)
+			return;
+
+		auto newest = outputTime;
+		for (const auto& input : task.inputs)
+		{
+			auto inputTime = std::filesystem::last_write_time(input, error);
+			if (!error && inputTime > newest)
+				newest = inputTime;
+		}
+
+		if (newest > outputTime)
+			std::filesystem::last_write_time(task.output, newest, error);
+	}
+
+	//One "<hash> <key>" line per output that cooked cleanly
+	static std::unordered_map<std::string, uint64_t> ReadManifest(const std::filesystem::path& path)
+	{
+		std::unordered_map<std::string, uint64_t> hashes;
+		std::ifstream file(path);
+
+		std::string line;
+		while (std::getline(file, line))
+		{
+			size_t space = line.find(' ');
+			if (space == std::string::npos || space + 1 == line.size())
+				continue;
+
+			//A line cut short by a killed cook is dropped, its output just counts as stale
+			uint64_t hash = 0;
+			const char* end = line.data() + space;
+			auto [ptr, error] = std::from_chars(line.data(), end, hash, 16);
+			if (error != std::errc() || ptr != end)
+				continue;
+
+			hashes[line.substr(space + 1)] = hash;
+		}
+
+		return hashes;
+	}
+
+	static bool WriteManifest(const std::filesystem::path& path, const std::vector<CookTask>& tasks)
+	{
+		std::filesystem::path temp = path;
+		temp += ".tmp";
+
+		{
+			std::ofstream out(temp, std::ios::trunc);
+			for (const auto& task : tasks)
+			{
+				//Failed outputs are left out so the next run tries them again
+				if (task.result != TaskResult::Failed)
+					out << std::hex << std::setw(16) << std::setfill('0') << task.hash << " " << task.key << "\n";
+			}
+
+			if (!out)
+			{
+				std::cerr << "Cannot write: " << temp.string() << "\n";
+				return false;
+			}
+		}
+
+		std::error_code error;
+		std::filesystem::rename(temp, path, error);
+		if (error)
+		{
+			std::cerr << "Cannot replace: " << path.string() << "\n";
+			return false;
+		}
+
+		return true;
+	}
+
+	bool IncrementalCook::Cook(const std::filesystem::path& assetsDir, unsigned jobs)
+	{
+		if (!std::filesystem::is_directory(assetsDir))
+		{
+			std::cerr << "Assets folder not found: " << assetsDir.string() << "\n";
+			return false;
+		}
+
+		auto start = std::chrono::steady_clock::now();
+
+		std::filesystem::path manifestPath = assetsDir / MANIFEST_FILE;
+		std::unordered_map<std::string, uint64_t> previous = ReadManifest(manifestPath);
+		std::vector<CookTask> tasks = GatherTasks(assetsDir);
+
+		//Hashing runs on the workers too
+		unsigned threads = ParallelFor(tasks.size(), jobs, [&](size_t i)
+		{
+			CookTask& task = tasks[i];
+			if (!HashInputs(assetsDir, task))
+				return;
+
+			auto found = previous.find(task.key);
+			if (found != previous.end() && found->second == task.hash && std::filesystem::exists(task.output))
+			{
+				task.result = TaskResult::UpToDate;
+				TouchOutput(task);
+				return;
+			}
+
+			task.result = task.cook() ? TaskResult::Cooked : TaskResult::Failed;
+		});
+
+		size_t cooked = std::count_if(tasks.begin(), tasks.end(), [](const CookTask& task) { return task.result == TaskResult::Cooked; });
+		size_t failed = std::count_if(tasks.begin(), tasks.end(), [](const CookTask& task) { return task.result == TaskResult::Failed; });
+		bool written = WriteManifest(manifestPath, tasks);
+
+		double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		std::cout << "Cooked " << cooked << ", up to date " << tasks.size() - cooked - failed << ", failed " << failed
+			<< " on " << threads << " threads in " << elapsedMs << " ms\n";
+
+		return written && failed == 0;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,15 @@
+#pragma once
+#include <filesystem>
+
+namespace TTCook
+{
+	//Cooks every runtime format under Assets on all cores. A content hash of each output's inputs
+	//is kept in the cook manifest, outputs whose inputs hash the same as last time are skipped
+	class IncrementalCook
+	{
+	public:
+		static constexpr const char* MANIFEST_FILE = ".ttcook";	//Under Assets, left out of the pak
+
+		static bool Cook(const std::filesystem::path& assetsDir, unsigned jobs);	//0 jobs uses every core
+	};
+}
\ No newline at end of file
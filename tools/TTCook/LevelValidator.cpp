@@ -0,0 +1,309 @@
+#include "LevelValidator.h"
+#include "MapCooker.h"
+#include "RecordFile.h"
+#include "Parallel.h"
+#include "Core/Data/Level/LevelParser.h"
+#include "Core/Data/Entity/EntityParser.h"
+#include "Core/Data/Entity/EntityPhysics.h"
+#include "Core/Data/Interactable/InteractableParser.h"
+#include "Core/Data/Interactable/TrapParser.h"
+#include <iostream>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+
+namespace TTCook
+{
+	//Collision cell values, see EngineGame::TileType
+	constexpr uint8_t CELL_GROUND = 1;
+	constexpr uint8_t CELL_WALL = 2;
+
+	//Definition ids a map may use, interactables keep their type for the reachability targets
+	struct KnownDefinitions
+	{
+		EngineData::DataArena arena;
+		std::unordered_map<std::string_view, const EngineData::EntityData*> entities;
+		std::unordered_map<std::string_view, std::string_view> interactables;
+		std::unordered_set<std::string_view> traps;
+
+		std::vector<EngineData::EntityData> entityList;
+		std::vector<EngineData::InteractableData> interactableList;
+		std::vector<EngineData::TrapData> trapList;
+	};
+
+	//Tile grid of one map with the player's size and jump worked out in cells
+	class ReachGrid
+	{
+	public:
+		ReachGrid(const EngineData::MapData& map, float playerSpeed)
+			: m_Width(map.w), m_Height(map.h), m_Cells(map.tiles.GetData())
+		{
+			float tile = static_cast<float>(map.tSize);
+			m_BodyW = std::max(1, static_cast<int>(std::ceil(EngineData::ENTITY_COLLIDER_WIDTH / tile)));
+			m_BodyH = std::max(1, static_cast<int>(std::ceil(EngineData::ENTITY_COLLIDER_HEIGHT / tile)));
+
+			//Peak of v^2 / 2g, the player drifts sideways for the whole time in the air
+			float jumpHeight = EngineData::PLAYER_JUMP_FORCE * EngineData::PLAYER_JUMP_FORCE / (2.0f * EngineData::ENTITY_GRAVITY);
+			float airTime = 2.0f * EngineData::PLAYER_JUMP_FORCE / EngineData::ENTITY_GRAVITY;
+			m_JumpCells = static_cast<int>(jumpHeight / tile);
+			m_DriftCells = static_cast<int>(std::ceil(playerSpeed * airTime / tile));
+		}
+
+		bool IsInside(int x, int y) const { return x >= 0 && x < m_Width && y >= 0 && y < m_Height; }
+		uint8_t GetCell(int x, int y) const { return m_Cells[size_t(y) * m_Width + x]; }
+
+		//Walls block from every side, ground is only stood on
+		bool Fits(int x, int y) const
+		{
+			for (int cy = y; cy < y + m_BodyH; cy++)
+			{
+				for (int cx = x; cx < x + m_BodyW; cx++)
+				{
+					if (!IsInside(cx, cy) || GetCell(cx, cy) == CELL_WALL)
+						return false;
+				}
+			}
+			return true;
+		}
+
+		bool IsStanding(int x, int y) const
+		{
+			int below = y + m_BodyH;
+			for (int cx = x; cx < x + m_BodyW; cx++)
+			{
+				if (IsInside(cx, below) && GetCell(cx, below) != 0)
+					return true;
+			}
+			return false;
+		}
+
+		//Every cell the body covers while moving along the jump and fall paths from (startX, startY)
+		std::vector<uint8_t> Flood(int startX, int startY) const
+		{
+			std::vector<uint8_t> touched(size_t(m_Width) * m_Height, 0);
+			std::vector<uint8_t> stood(size_t(m_Width) * m_Height, 0);
+			std::vector<std::pair<int, int>> open;
+
+			Land(startX, startY, touched, stood, open);
+			while (!open.empty())
+			{
+				auto [x, y] = open.back();
+				open.pop_back();
+
+				//Walking off either side, then every jump height with every sideways drift
+				for (int up = 0; up <= m_JumpCells; up++)
+				{
+					if (!Fits(x, y - up))
+						break;
+					Touch(x, y - up, touched);
+
+					for (int dir = -1; dir <= 1; dir += 2)
+					{
+						for (int step = 1; step <= (up == 0 ? 1 : m_DriftCells); step++)
+						{
+							int nx = x + dir * step;
+							if (!Fits(nx, y - up))
+								break;
+							Land(nx, y - up, touched, stood, open);
+						}
+					}
+				}
+			}
+
+			return touched;
+		}
+
+		int GetBodyW() const { return m_BodyW; }
+		int GetBodyH() const { return m_BodyH; }
+	private:
+		void Touch(int x, int y, std::vector<uint8_t>& touched) const
+		{
+			for (int cy = y; cy < y + m_BodyH; cy++)
+			{
+				for (int cx = x; cx < x + m_BodyW; cx++)
+					touched[size_t(cy) * m_Width + cx] = 1;
+			}
+		}
+
+		//Falls straight down from (x, y), queues the spot it lands on the first time it is reached
+		void Land(int x, int y, std::vector<uint8_t>& touched, std::vector<uint8_t>& stood, std::vector<std::pair<int, int>>& open) const
+		{
+			if (!Fits(x, y))
+				return;
+
+			while (!IsStanding(x, y))
+			{
+				Touch(x, y, touched);
+				if (!Fits(x, y + 1))
+					return;		//Fell out of the map
+				y++;
+			}
+
+			Touch(x, y, touched);
+			uint8_t& seen = stood[size_t(y) * m_Width + x];
+			if (!seen)
+			{
+				seen = 1;
+				open.emplace_back(x, y);
+			}
+		}
+
+		int m_Width;
+		int m_Height;
+		const uint8_t* m_Cells;
+		int m_BodyW = 1;
+		int m_BodyH = 1;
+		int m_JumpCells = 0;
+		int m_DriftCells = 0;
+	};
+
+	static std::string Cell(const EngineData::SpawnData& spawn)
+	{
+		return std::to_string(static_cast<int>(std::floor(spawn.x))) + "," + std::to_string(static_cast<int>(std::floor(spawn.y)));
+	}
+
+	static bool OverlapsWall(const EngineData::MapData& map, const EngineData::SpawnData& spawn, int w, int h)
+	{
+		int x0 = static_cast<int>(std::floor(spawn.x));
+		int y0 = static_cast<int>(std::floor(spawn.y));
+		for (int y = y0; y < y0 + h; y++)
+		{
+			for (int x = x0; x < x0 + w; x++)
+			{
+				if (x < 0 || x >= map.w || y < 0 || y >= map.h || map.tiles.GetData()[size_t(y) * map.w + x] == CELL_WALL)
+					return true;
+			}
+		}
+		return false;
+	}
+
+	static void ValidateMap(const std::filesystem::path& path, const KnownDefinitions& defs, std::vector<std::string>& outErrors)
+	{
+		EngineData::MapData map{};
+		if (!MapCooker::Read(path, map))
+		{
+			outErrors.push_back("map could not be loaded");
+			return;
+		}
+
+		const EngineData::SpawnData* player = nullptr;
+		for (const auto& spawn : map.spawns)
+		{
+			auto def = defs.entities.find(spawn.defId);
+			if (def == defs.entities.end())
+				outErrors.push_back("unknown entity '" + spawn.defId + "' at " + Cell(spawn));
+
+			if (spawn.defId == "Player")
+			{
+				if (player)
+					outErrors.push_back("more than one player spawn, the one at " + Cell(spawn) + " is ignored");
+				else
+					player = &spawn;
+			}
+		}
+
+		for (const auto& spawn : map.interactables)
+		{
+			if (!defs.interactables.contains(spawn.defId))
+				outErrors.push_back("unknown interactable '" + spawn.defId + "' at " + Cell(spawn));
+			if (OverlapsWall(map, spawn, 1, 1))
+				outErrors.push_back("interactable '" + spawn.defId + "' at " + Cell(spawn) + " is inside a wall");
+		}
+
+		for (const auto& spawn : map.traps)
+		{
+			if (!defs.traps.contains(spawn.defId))
+				outErrors.push_back("unknown trap '" + spawn.defId + "' at " + Cell(spawn));
+			if (OverlapsWall(map, spawn, 1, 1))
+				outErrors.push_back("trap '" + spawn.defId + "' at " + Cell(spawn) + " is inside a wall");
+		}
+
+		if (!player)
+		{
+			outErrors.push_back("no player spawn");
+			return;
+		}
+
+		auto playerDef = defs.entities.find(player->defId);
+		float speed = playerDef != defs.entities.end() ? playerDef->second->speed : 0.0f;
+		ReachGrid grid(map, speed);
+
+		for (const auto& spawn : map.spawns)
+		{
+			if (OverlapsWall(map, spawn, grid.GetBodyW(), grid.GetBodyH()))
+				outErrors.push_back("'" + spawn.defId + "' spawn at " + Cell(spawn) + " overlaps a wall");
+		}
+
+		//The level can only be finished when every key, chest and door is somewhere the player can get to
+		std::vector<uint8_t> touched = grid.Flood(static_cast<int>(std::floor(player->x)), static_cast<int>(std::floor(player->y)));
+		for (const auto& spawn : map.interactables)
+		{
+			auto def = defs.interactables.find(spawn.defId);
+			if (def == defs.interactables.end() || (def->second != "Key" && def->second != "Chest" && def->second != "Door"))
+				continue;
+
+			int x = static_cast<int>(std::floor(spawn.x));
+			int y = static_cast<int>(std::floor(spawn.y));
+			if (grid.IsInside(x, y) && !touched[size_t(y) * map.w + x])
+				outErrors.push_back(std::string(def->second) + " '" + spawn.defId + "' at " + Cell(spawn) + " cannot be reached from the player spawn");
+		}
+	}
+
+	static bool LoadDefinitions(const std::filesystem::path& dataDir, KnownDefinitions& outDefs)
+	{
+		if (!ReadRecords<EngineData::EntityData, EngineData::EntityParser>(dataDir / "entity_def.json", outDefs.arena, outDefs.entityList) ||
+			!ReadRecords<EngineData::InteractableData, EngineData::InteractableParser>(dataDir / "Interactables.json", outDefs.arena, outDefs.interactableList) ||
+			!ReadRecords<EngineData::TrapData, EngineData::TrapParser>(dataDir / "TrapDef.json", outDefs.arena, outDefs.trapList))
+			return false;
+
+		for (const auto& entity : outDefs.entityList)
+			outDefs.entities[entity.id] = &entity;
+		for (const auto& interactable : outDefs.interactableList)
+			outDefs.interactables[interactable.id] = interactable.type;
+		for (const auto& trap : outDefs.trapList)
+			outDefs.traps.insert(trap.id);
+
+		return true;
+	}
+
+	bool LevelValidator::Validate(const std::filesystem::path& assetsDir, unsigned jobs)
+	{
+		auto start = std::chrono::steady_clock::now();
+
+		KnownDefinitions defs;
+		std::vector<EngineData::LevelData> levels;
+		EngineData::DataArena arena;
+
+		std::filesystem::path dataDir = assetsDir / "Data";
+		if (!LoadDefinitions(dataDir, defs) ||
+			!ReadRecords<EngineData::LevelData, EngineData::LevelParser>(dataDir / "Levels.json", arena, levels, "Levels"))
+			return false;
+
+		//Each level collects its own messages, they are printed in Levels.json order afterwards
+		std::vector<std::vector<std::string>> errors(levels.size());
+		unsigned threads = ParallelFor(levels.size(), jobs, [&](size_t i)
+		{
+			std::filesystem::path path = assetsDir / "Maps" / (levels[i].mapId + ".json");
+			ValidateMap(path, defs, errors[i]);
+		});
+
+		size_t errorCount = 0;
+		for (size_t i = 0; i < levels.size(); i++)
+		{
+			for (const auto& error : errors[i])
+				std::cerr << levels[i].id << " (" << levels[i].mapId << "): " << error << "\n";
+			errorCount += errors[i].size();
+		}
+
+		double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		std::cout << "Validated " << levels.size() << " levels, " << errorCount << " errors on " << threads << " threads in " << elapsedMs << " ms\n";
+
+		return errorCount == 0;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,13 @@
+#pragma once
+#include <filesystem>
+
+namespace TTCook
+{
+	//Checks every level in Levels.json without running the game: definitions, spawns inside walls
+	//and whether keys, chests and doors can be reached from the player spawn
+	class LevelValidator
+	{
+	public:
+		static bool Validate(const std::filesystem::path& assetsDir, unsigned jobs);	//0 jobs uses every core
+	};
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#include "PakWriter.h"
+#include "MapCooker.h"
+#include "DefsCooker.h"
+#include "IncrementalCook.h"
+#include "LevelValidator.h"
+#include <iostream>
+#include <string>
+#include <cstdlib>
+
+static void PrintUsage()
+{
+	std::cout <<
+		"Usage: TTCook <command> [args]\n"
+		"  pak <assetsDir> <output.ttpak>   Pack an Assets folder\n"
+		"  map <map.json> <output.ttmap>    Convert an editor map to binary\n"
+		"  map <mapsDir>                    Convert every map in a folder\n"
+		"  world <map.json> <output.ttworld> [chunkSize]\n"
+		"                                   Split a map into streamed chunks\n"
+		"  defs <assetsDir> <output.ttdefs> Cook every definition library\n"
+		"  cook <assetsDir> [jobs]          Cook maps, worlds and definitions that changed\n"
+		"  validate <assetsDir> [jobs]      Check every level for broken spawns and unreachable goals\n";
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	std::string command = argv[1];
+
+	if (command == "pak" && argc == 4)
+		return TTCook::PakWriter::Write(argv[2], argv[3]) ? 0 : 1;
+
+	if (command == "map" && argc == 4)
+		return TTCook::MapCooker::Cook(argv[2], argv[3]) ? 0 : 1;
+
+	if (command == "map" && argc == 3)
+		return TTCook::MapCooker::CookFolder(argv[2]) ? 0 : 1;
+
+	if (command == "world" && (argc == 4 || argc == 5))
+	{
+		int chunkSize = argc == 5 ? std::atoi(argv[4]) : TTCook::MapCooker::DEFAULT_CHUNK_SIZE;
+		return TTCook::MapCooker::CookWorld(argv[2], argv[3], chunkSize) ? 0 : 1;
+	}
+
+	if (command == "defs" && argc == 4)
+		return TTCook::DefsCooker::Cook(argv[2], argv[3]) ? 0 : 1;
+
+	if (command == "cook" && (argc == 3 || argc == 4))
+	{
+		unsigned jobs = argc == 4 ? static_cast<unsigned>(std::atoi(argv[3])) : 0;
+		return TTCook::IncrementalCook::Cook(argv[2], jobs) ? 0 : 1;
+	}
+
+	if (command == "validate" && (argc == 3 || argc == 4))
+	{
+		unsigned jobs = argc == 4 ? static_cast<unsigned>(std::atoi(argv[3])) : 0;
+		return TTCook::LevelValidator::Validate(argv[2], jobs) ? 0 : 1;
+	}
+
+	PrintUsage();
+	return 1;
+}
\ No newline at end of file
@@ -0,0 +1,265 @@
+#include "MapCooker.h"
+#include "Core/Data/Map/MapFormat.h"
+#include "Core/Data/Map/WorldFormat.h"
+#include "Core/Data/Map/MapParser.h"
+#include "RecordFile.h"
+#include <fstream>
+#include <iostream>
+#include <syncstream>
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <iterator>
+#include <algorithm>
+#include <cmath>
+
+namespace TTCook
+{
+	class StringTable
+	{
+	public:
+		uint32_t Add(const std::string& text)
+		{
+			auto it = m_Offsets.find(text);
+			if (it != m_Offsets.end())
+				return it->second;
+
+			uint32_t offset = static_cast<uint32_t>(m_Data.size());
+			m_Data += text;
+			m_Offsets.emplace(text, offset);
+			return offset;
+		}
+
+		const std::string& GetData() const { return m_Data; }
+	private:
+		std::string m_Data;
+		std::unordered_map<std::string, uint32_t> m_Offsets;
+	};
+
+	static void AddSpawns(const std::vector<EngineData::SpawnData>& spawns, StringTable& strings, std::vector<EngineData::MapFileSpawn>& outTable)
+	{
+		for (const auto& spawn : spawns)
+		{
+			EngineData::MapFileSpawn entry{};
+			entry.x = spawn.x;
+			entry.y = spawn.y;
+			entry.defOffset = strings.Add(spawn.defId);
+			entry.defLength = static_cast<uint32_t>(spawn.defId.size());
+			outTable.push_back(entry);
+		}
+	}
+
+	static uint64_t Align(uint64_t offset, uint64_t alignment)
+	{
+		return (offset + alignment - 1) / alignment * alignment;
+	}
+
+	bool MapCooker::Read(const std::filesystem::path& input, EngineData::MapData& outMap)
+	{
+		std::ifstream file(input, std::ios::binary);
+		if (!file.is_open())
+		{
+			std::osyncstream(std::cerr) << "Cannot read: " << input.string() << "\n";
+			return false;
+		}
+
+		std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+		EngineData::MapParser parser(outMap);
+		if (!parser.Parse(text) || !parser.Finish())
+		{
+			std::osyncstream(std::cerr) << "Not a valid map: " << input.string() << "\n" << parser.GetError() << "\n";
+			return false;
+		}
+
+		return true;
+	}
+
+	bool MapCooker::Cook(const std::filesystem::path& input, const std::filesystem::path& output)
+	{
+		EngineData::MapData map{};
+		if (!Read(input, map))
+			return false;
+
+		StringTable strings;
+		std::vector<EngineData::MapFileSpawn> table;
+		AddSpawns(map.spawns, strings, table);
+		AddSpawns(map.interactables, strings, table);
+		AddSpawns(map.traps, strings, table);
+
+		EngineData::MapFileHeader header{};
+		header.magic = EngineData::MAP_MAGIC;
+		header.version = EngineData::MAP_VERSION;
+		header.width = map.w;
+		header.height = map.h;
+		header.tileSize = map.tSize;
+		header.spawnCount = static_cast<uint32_t>(map.spawns.size());
+		header.interactableCount = static_cast<uint32_t>(map.interactables.size());
+		header.trapCount = static_cast<uint32_t>(map.traps.size());
+		header.tilesOffset = sizeof(header);
+		header.spawnsOffset = Align(header.tilesOffset + map.tiles.GetSize(), alignof(EngineData::MapFileSpawn));
+		header.stringsOffset = header.spawnsOffset + table.size() * sizeof(EngineData::MapFileSpawn);
+		header.stringsSize = strings.GetData().size();
+
+		std::vector<uint8_t> bytes(static_cast<size_t>(header.stringsOffset + header.stringsSize), 0);
+		std::memcpy(bytes.data(), &header, sizeof(header));
+		std::memcpy(bytes.data() + header.tilesOffset, map.tiles.GetData(), map.tiles.GetSize());
+		if (!table.empty())
+			std::memcpy(bytes.data() + header.spawnsOffset, table.data(), table.size() * sizeof(EngineData::MapFileSpawn));
+		std::memcpy(bytes.data() + header.stringsOffset, strings.GetData().data(), strings.GetData().size());
+
+		if (!ReplaceFile(output, bytes))
+			return false;
+
+		std::osyncstream(std::cout) << input.filename().string() << " -> " << output.filename().string()
+			<< " (" << map.w << "x" << map.h << ", " << bytes.size() << " bytes)\n";
+		return true;
+	}
+
+	//Spawn positions are in tiles, each one goes to the chunk its cell is in
+	static int ChunkOf(float tile, int chunkSize, int chunkCount)
+	{
+		int chunk = static_cast<int>(std::floor(tile)) / chunkSize;
+		return std::clamp(chunk, 0, chunkCount - 1);
+	}
+
+	bool MapCooker::CookWorld(const std::filesystem::path& input, const std::filesystem::path& output, int chunkSize)
+	{
+		if (chunkSize <= 0 || chunkSize > 1024)
+		{
+			std::osyncstream(std::cerr) << "Chunk size must be between 1 and 1024\n";
+			return false;
+		}
+
+		EngineData::MapData map{};
+		if (!Read(input, map))
+			return false;
+
+		if (map.spawns.empty() || map.spawns.front().defId != "Player")
+		{
+			std::osyncstream(std::cerr) << "World maps need a player spawn: " << input.string() << "\n";
+			return false;
+		}
+
+		const int chunksX = (map.w + chunkSize - 1) / chunkSize;
+		const int chunksY = (map.h + chunkSize - 1) / chunkSize;
+		const size_t chunkCount = size_t(chunksX) * size_t(chunksY);
+
+		struct ChunkSpawns
+		{
+			std::vector<EngineData::SpawnData> enemies;
+			std::vector<EngineData::SpawnData> interactables;
+			std::vector<EngineData::SpawnData> traps;
+		};
+
+		std::vector<ChunkSpawns> chunks(chunkCount);
+		auto distribute = [&](const std::vector<EngineData::SpawnData>& spawns, size_t first, std::vector<EngineData::SpawnData> ChunkSpawns::* list)
+		{
+			for (size_t i = first; i < spawns.size(); i++)
+			{
+				size_t index = size_t(ChunkOf(spawns[i].y, chunkSize, chunksY)) * chunksX + ChunkOf(spawns[i].x, chunkSize, chunksX);
+				(chunks[index].*list).push_back(spawns[i]);
+			}
+		};
+
+		distribute(map.spawns, 1, &ChunkSpawns::enemies);
+		distribute(map.interactables, 0, &ChunkSpawns::interactables);
+		distribute(map.traps, 0, &ChunkSpawns::traps);
+
+		StringTable strings;
+		const EngineData::SpawnData& player = map.spawns.front();
+
+		EngineData::WorldFileHeader header{};
+		header.magic = EngineData::WORLD_MAGIC;
+		header.version = EngineData::WORLD_VERSION;
+		header.width = map.w;
+		header.height = map.h;
+		header.tileSize = map.tSize;
+		header.chunkSize = chunkSize;
+		header.chunksX = chunksX;
+		header.chunksY = chunksY;
+		header.player = { player.x, player.y, strings.Add(player.defId), static_cast<uint32_t>(player.defId.size()) };
+		header.chunksOffset = sizeof(header);
+
+		//Blobs are laid out row by row, neighbours on disk are neighbours in the world
+		std::vector<EngineData::WorldFileChunk> table(chunkCount);
+		std::vector<uint8_t> blobs;
+		const uint64_t cells = uint64_t(chunkSize) * chunkSize;
+		const uint64_t blobStart = Align(header.chunksOffset + chunkCount * sizeof(EngineData::WorldFileChunk), 8);
+
+		for (int cy = 0; cy < chunksY; cy++)
+		{
+			for (int cx = 0; cx < chunksX; cx++)
+			{
+				size_t index = size_t(cy) * chunksX + cx;
+				const ChunkSpawns& spawns = chunks[index];
+
+				EngineData::WorldFileChunk& entry = table[index];
+				entry.offset = blobStart + blobs.size();
+				entry.enemyCount = static_cast<uint32_t>(spawns.enemies.size());
+				entry.interactableCount = static_cast<uint32_t>(spawns.interactables.size());
+				entry.trapCount = static_cast<uint32_t>(spawns.traps.size());
+
+				//Cells past the map edge read as walls, the same as outside a TileMap
+				size_t blob = blobs.size();
+				blobs.resize(blob + cells, EngineData::WORLD_PAD_CELL);
+				for (int y = 0; y < chunkSize; y++)
+				{
+					int mapY = cy * chunkSize + y;
+					int mapX = cx * chunkSize;
+					if (mapY >= map.h)
+						break;
+
+					int count = std::min(chunkSize, map.w - mapX);
+					std::memcpy(blobs.data() + blob + size_t(y) * chunkSize, map.tiles.GetData() + size_t(mapY) * map.w + mapX, count);
+				}
+
+				std::vector<EngineData::MapFileSpawn> spawnTable;
+				AddSpawns(spawns.enemies, strings, spawnTable);
+				AddSpawns(spawns.interactables, strings, spawnTable);
+				AddSpawns(spawns.traps, strings, spawnTable);
+
+				blobs.resize(blob + EngineData::WorldChunkSpawnsOffset(chunkSize), 0);
+				size_t spawnBytes = spawnTable.size() * sizeof(EngineData::MapFileSpawn);
+				blobs.resize(Align(blobs.size() + spawnBytes, 8), 0);
+				if (!spawnTable.empty())
+					std::memcpy(blobs.data() + blob + EngineData::WorldChunkSpawnsOffset(chunkSize), spawnTable.data(), spawnBytes);
+			}
+		}
+
+		header.stringsOffset = blobStart + blobs.size();
+		header.stringsSize = strings.GetData().size();
+
+		std::vector<uint8_t> bytes(static_cast<size_t>(header.stringsOffset + header.stringsSize), 0);
+		std::memcpy(bytes.data(), &header, sizeof(header));
+		std::memcpy(bytes.data() + header.chunksOffset, table.data(), table.size() * sizeof(EngineData::WorldFileChunk));
+		std::memcpy(bytes.data() + blobStart, blobs.data(), blobs.size());
+		std::memcpy(bytes.data() + header.stringsOffset, strings.GetData().data(), strings.GetData().size());
+
+		if (!ReplaceFile(output, bytes))
+			return false;
+
+		std::osyncstream(std::cout) << input.filename().string() << " -> " << output.filename().string()
+			<< " (" << map.w << "x" << map.h << ", " << chunksX << "x" << chunksY << " chunks of " << chunkSize
+			<< ", " << bytes.size() << " bytes)\n";
+		return true;
+	}
+
+	bool MapCooker::CookFolder(const std::filesystem::path& mapsDir)
+	{
+		bool ok = true;
+		for (auto& file : std::filesystem::directory_iterator(mapsDir))
+		{
+			const auto& path = file.path();
+			if (path.extension() != ".json" || path.stem().extension() == ".deps")
+				continue;
+
+			std::filesystem::path output = path;
+			output.replace_extension(".ttmap");
+			ok &= Cook(path, output);
+		}
+
+		return ok;
+	}
+}
\ No newline at end of file
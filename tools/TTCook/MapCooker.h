@@ -0,0 +1,19 @@
+#pragma once
+#include <filesystem>
+#include "Core/Data/Map/MapData.h"
+
+namespace TTCook
+{
+	//Editor map json to .ttmap
+	class MapCooker
+	{
+	public:
+		static bool Cook(const std::filesystem::path& input, const std::filesystem::path& output);
+		static bool CookFolder(const std::filesystem::path& mapsDir);	//Every map json, written next to it
+		static bool Read(const std::filesystem::path& input, EngineData::MapData& outMap);		//Parsed and checked against its size
+
+		//Editor map json to a chunked .ttworld for streamed levels
+		static constexpr int DEFAULT_CHUNK_SIZE = 32;
+		static bool CookWorld(const std::filesystem::path& input, const std::filesystem::path& output, int chunkSize);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,164 @@
+#include "PakWriter.h"
+#include "IncrementalCook.h"
+#include "Core/PakFormat.h"
+#include "Core/Hash.h"
+#include "Core/Lz4.h"
+#include <fstream>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <algorithm>
+
+namespace TTCook
+{
+	//Already compressed formats are stored raw so the runtime can use them in place
+	static bool ShouldCompress(const std::filesystem::path& path)
+	{
+		std::string ext = path.extension().string();
+		std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+		return ext != ".png" && ext != ".ttf" && ext != ".otf" && ext != ".ttpak";
+	}
+
+	static bool ReadFile(const std::filesystem::path& path, std::vector<uint8_t>& outData)
+	{
+		std::ifstream file(path, std::ios::binary | std::ios::ate);
+		if (!file.is_open())
+			return false;
+
+		outData.resize(static_cast<size_t>(file.tellg()));
+		file.seekg(0);
+		file.read(reinterpret_cast<char*>(outData.data()), static_cast<std::streamsize>(outData.size()));
+		return static_cast<bool>(file);
+	}
+
+	static void Pad(std::ofstream& out, uint64_t& offset, uint64_t alignment)
+	{
+		static const char zeros[EngineCore::PAK_ALIGNMENT] = {};
+		uint64_t padding = (alignment - offset % alignment) % alignment;
+		out.write(zeros, static_cast<std::streamsize>(padding));
+		offset += padding;
+	}
+
+	bool PakWriter::Write(const std::filesystem::path& assetsDir, const std::filesystem::path& output)
+	{
+		if (!std::filesystem::is_directory(assetsDir))
+		{
+			std::cerr << "Assets folder not found: " << assetsDir.string() << "\n";
+			return false;
+		}
+
+		std::vector<std::filesystem::path> files;
+		for (auto& file : std::filesystem::recursive_directory_iterator(assetsDir))
+		{
+			//The cook manifest only matters on the machine that cooked
+			if (file.is_regular_file() && file.path().filename() != IncrementalCook::MANIFEST_FILE)
+				files.push_back(file.path());
+		}
+
+		std::filesystem::path temp = output;
+		temp += ".tmp";
+
+		std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+		if (!out.is_open())
+		{
+			std::cerr << "Cannot write: " << temp.string() << "\n";
+			return false;
+		}
+
+		//Header is rewritten once the table offsets are known
+		EngineCore::PakHeader header{};
+		header.magic = EngineCore::PAK_MAGIC;
+		header.version = EngineCore::PAK_VERSION;
+		header.entryCount = static_cast<uint32_t>(files.size());
+		out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+		uint64_t offset = sizeof(header);
+		uint64_t rawTotal = 0;
+		uint64_t storedTotal = 0;
+
+		std::vector<EngineCore::PakEntry> entries;
+		std::string names;
+		std::vector<uint8_t> data;
+		std::vector<uint8_t> compressed;
+
+		for (const auto& file : files)
+		{
+			if (!ReadFile(file, data))
+			{
+				std::cerr << "Cannot read: " << file.string() << "\n";
+				out.close();
+				std::error_code error;
+				std::filesystem::remove(temp, error);
+				return false;
+			}
+
+			std::string key = std::filesystem::relative(file, assetsDir).generic_string();
+
+			EngineCore::PakEntry entry{};
+			entry.pathHash = EngineCore::HashFnv1a64(key);
+			entry.size = data.size();
+			entry.nameOffset = static_cast<uint32_t>(names.size());
+			names.append(key);
+			names.push_back('\0');
+
+			const std::vector<uint8_t>* stored = &data;
+			if (ShouldCompress(file) && !data.empty())
+			{
+				//Only worth a decompress if it saves at least 10%
+				EngineCore::Lz4::Compress(data.data(), data.size(), compressed);
+				if (compressed.size() < data.size() - data.size() / 10)
+				{
+					stored = &compressed;
+					entry.flags |= EngineCore::PAK_ENTRY_LZ4;
+				}
+			}
+
+			Pad(out, offset, EngineCore::PAK_ALIGNMENT);
+			entry.offset = offset;
+			entry.storedSize = stored->size();
+			out.write(reinterpret_cast<const char*>(stored->data()), static_cast<std::streamsize>(stored->size()));
+			offset += stored->size();
+
+			rawTotal += entry.size;
+			storedTotal += entry.storedSize;
+			entries.push_back(entry);
+		}
+
+		std::sort(entries.begin(), entries.end(), [](const EngineCore::PakEntry& a, const EngineCore::PakEntry& b)
+		{
+			return a.pathHash < b.pathHash;
+		});
+
+		Pad(out, offset, alignof(EngineCore::PakEntry));
+		header.tocOffset = offset;
+		out.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(EngineCore::PakEntry)));
+		offset += entries.size() * sizeof(EngineCore::PakEntry);
+
+		header.namesOffset = offset;
+		out.write(names.data(), static_cast<std::streamsize>(names.size()));
+
+		out.seekp(0);
+		out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		out.close();
+
+		//A failed pack leaves nothing behind, the old one stays in place
+		std::error_code error;
+		if (!out)
+		{
+			std::cerr << "Failed writing: " << temp.string() << "\n";
+			std::filesystem::remove(temp, error);
+			return false;
+		}
+
+		std::filesystem::rename(temp, output, error);
+		if (error)
+		{
+			std::cerr << "Cannot replace: " << output.string() << "\n";
+			std::filesystem::remove(temp, error);
+			return false;
+		}
+
+		std::cout << "Packed " << entries.size() << " files, " << rawTotal << " -> " << storedTotal << " bytes into " << output.string() << "\n";
+		return true;
+	}
+}
\ No newline at end of file
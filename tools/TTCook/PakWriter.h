@@ -0,0 +1,12 @@
+#pragma once
+#include <filesystem>
+
+namespace TTCook
+{
+	//Packs every file under an Assets folder into one .ttpak
+	class PakWriter
+	{
+	public:
+		static bool Write(const std::filesystem::path& assetsDir, const std::filesystem::path& output);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,35 @@
+#pragma once
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+
+namespace TTCook
+{
+	//Runs fn(index) for every index on up to jobs threads, the calling thread is one of them.
+	//0 jobs uses every core, returns how many threads ran
+	template<typename Fn>
+	unsigned ParallelFor(size_t count, unsigned jobs, Fn&& fn)
+	{
+		if (jobs == 0)
+			jobs = std::max(1u, std::thread::hardware_concurrency());
+		jobs = static_cast<unsigned>(std::clamp<size_t>(count, 1, jobs));
+
+		std::atomic<size_t> next = 0;
+		auto worker = [&]()
+		{
+			for (size_t i = next++; i < count; i = next++)
+				fn(i);
+		};
+
+		std::vector<std::thread> threads;
+		for (unsigned i = 1; i < jobs; i++)
+			threads.emplace_back(worker);
+		worker();
+		for (auto& thread : threads)
+			thread.join();
+
+		return jobs;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,68 @@
+#pragma once
+#include "Core/Data/JsonRecordReader.h"
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <syncstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+
+namespace TTCook
+{
+	//Appends the records of one json file, listKey as in JsonRecordReader
+	template<typename T, typename Parser>
+	bool ReadRecords(const std::filesystem::path& path, EngineData::DataArena& arena, std::vector<T>& outItems, std::string_view listKey = {})
+	{
+		std::ifstream file(path, std::ios::binary);
+		if (!file.is_open())
+		{
+			std::osyncstream(std::cerr) << "Cannot read: " << path.string() << "\n";
+			return false;
+		}
+
+		std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+		EngineData::JsonRecordReader<T, Parser> reader(outItems, arena, listKey);
+		if (!reader.Parse(text))
+		{
+			std::osyncstream(std::cerr) << "Json parse error: " << path.string() << "\n" << reader.GetError() << "\n";
+			return false;
+		}
+
+		return true;
+	}
+
+	//Written next to the output and renamed over it, the engine may have the old file mapped while it runs
+	inline bool ReplaceFile(const std::filesystem::path& output, const std::vector<uint8_t>& bytes)
+	{
+		std::filesystem::path temp = output;
+		temp += ".tmp";
+
+		std::error_code error;
+		{
+			std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+			out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+			out.close();
+
+			if (!out)
+			{
+				std::osyncstream(std::cerr) << "Cannot write: " << temp.string() << "\n";
+				std::filesystem::remove(temp, error);
+				return false;
+			}
+		}
+
+		std::filesystem::rename(temp, output, error);
+		if (error)
+		{
+			std::osyncstream(std::cerr) << "Cannot replace: " << output.string() << "\n";
+			std::filesystem::remove(temp, error);
+			return false;
+		}
+
+		return true;
+	}
+}
\ No newline at end of file